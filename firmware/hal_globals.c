@@ -25,5 +25,8 @@ BINT halLongKeyPending __SYSTEM_GLOBAL__;
 BINT halKeyMenuSwitch  __SYSTEM_GLOBAL__;
 
 // RENDER CACHE
-WORDPTR halCacheContents[3 * MAX_RENDERCACHE_ENTRIES] __SYSTEM_GLOBAL__;
+WORDPTR halCacheBitmap[MAX_RENDERCACHE_ENTRIES] __SYSTEM_GLOBAL__;
+UNIFONT const **halCacheFont[MAX_RENDERCACHE_ENTRIES] __SYSTEM_GLOBAL__;
+WORD halCacheKey[3 * MAX_RENDERCACHE_ENTRIES] __SYSTEM_GLOBAL__;
 WORD halCacheEntry __SYSTEM_GLOBAL__;
+WORD halCacheState __SYSTEM_GLOBAL__;
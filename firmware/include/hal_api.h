@@ -135,9 +135,11 @@ enum halFonts
 #define BUFFER_ALT   32768
 
 
-// NUMBER OF ENTRIES IN THE RENDER CACHE
+// NUMBER OF ENTRIES IN THE RENDER CACHE (MUST BE A POWER OF 2)
 
 #define MAX_RENDERCACHE_ENTRIES 32
+// NUMBER OF CONSECUTIVE ENTRIES WHERE AN OBJECT CAN BE FOUND
+#define RENDERCACHE_PROBES 4
 
 // STRUCT TO CONTAIN THE HEIGHT IN PIXELS OF SCREEN AREAS (0=INVISIBLE)
 typedef struct
@@ -1263,8 +1265,11 @@ void halDeferProcess(void (*function)(void));
 
 
 // RENDER CACHE EXTERNAL DATA
-extern WORDPTR halCacheContents[3 * MAX_RENDERCACHE_ENTRIES];
-extern WORD halCacheEntry;
+extern WORDPTR halCacheBitmap[MAX_RENDERCACHE_ENTRIES];    // RENDERED BITMAPS, PATCHED BY THE GC
+extern UNIFONT const **halCacheFont[MAX_RENDERCACHE_ENTRIES];  // FONT USED TO RENDER EACH ENTRY
+extern WORD halCacheKey[3 * MAX_RENDERCACHE_ENTRIES];      // PROLOG AND 64-BIT CONTENT HASH OF THE OBJECT
+extern WORD halCacheEntry;     // ROUND-ROBIN COUNTER TO CHOOSE ENTRIES TO REPLACE
+extern WORD halCacheState;     // HASH OF THE DISPLAY SETTINGS USED TO RENDER ALL ENTRIES
 
 
 // RENDER
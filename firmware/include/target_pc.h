@@ -20,6 +20,15 @@
 
 #undef __ENABLE_ARM_ASSEMBLY__  // THIS TARGET IS NOT ARM
 
+// 64-BIT HOSTS USE WIDE ACCUMULATORS IN THE DECIMAL LIBRARY
+// BUILD WITH -DNO_HOST64_KERNELS TO USE THE GENERIC 32-BIT CODE
+#if defined(__SIZEOF_INT128__) && !defined(NO_HOST64_KERNELS)
+#define __ENABLE_HOST64_KERNELS__ 1
+#endif
+
+// THE HOST C LIBRARY PROVIDES THE TRANSCENDENTALS FOR THE FAST NUMERIC MODE
+#define __ENABLE_HOST_LIBM__ 1
+
 #undef __SYSTEM_GLOBAL__
 #define __SYSTEM_GLOBAL__
 
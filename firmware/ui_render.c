@@ -9,88 +9,148 @@
 #include <ui.h>
 #include <libraries.h>
 
-#define NEXT_ENTRY (halCacheEntry&0xffff)
-#define CACHE_FULL 0x10000
-
-#define INC_NEXT_ENTRY ((halCacheEntry+1)&(0xffff0000|(MAX_RENDERCACHE_ENTRIES-1)))
-
 #define MAX_BMP_WIDTH (4*SCREEN_WIDTH)       // MAXIMUM WIDTH OF A BITMAP TO RENDER AN OBJECT = 4 SCREENS
 #define MAX_BMP_HEIGHT (4*SCREEN_HEIGHT)      // MAXIMUM HEIGHT OF A BITMAP TO RENDER AN OBJECT = 4 SCREENS
 
+// THE RENDER CACHE IS KEYED BY THE CONTENTS OF THE OBJECT AND THE FONT, NOT ITS ADDRESS
+// SO A COPY OF AN OBJECT OR THE SAME OBJECT AFTER IT MOVED STILL FINDS ITS BITMAP
+// THE BITMAPS ARE GC ROOTS THAT ARE PATCHED BY THE COLLECTOR, SO THE CACHE SURVIVES
+// GARBAGE COLLECTION. AN OBJECT CAN ONLY BE IN RENDERCACHE_PROBES ENTRIES STARTING AT
+// THE ONE SELECTED BY ITS HASH
+
+// HASH ALL THE WORDS OF AN OBJECT INTO 2 INDEPENDENT 32-BIT HASHES
+static void uiObjectHash(WORDPTR object, WORD * hash)
+{
+    WORDPTR end = rplSkipOb(object);
+    WORD h1 = 2166136261U, h2 = 0x9e3779b9U;
+
+    while(object != end) {
+        h1 = (h1 ^ *object) * 16777619U;
+        h2 = ((h2 << 5) | (h2 >> 27)) ^ (*object * 0x85ebca6bU);
+        ++object;
+    }
+    hash[0] = h1;
+    hash[1] = h2 ^ (h2 >> 16);
+}
+
 // INVALIDATE ALL CACHE ENTRIES
+// ALSO RELEASES THE BITMAPS SO THEY CAN BE COLLECTED
 void uiClearRenderCache()
 {
+    int k;
+    for(k = 0; k < MAX_RENDERCACHE_ENTRIES; ++k)
+        halCacheBitmap[k] = 0;
     halCacheEntry = 0;
 }
 
-// ADD AN ENTRY TO THE CACHE
-void uiAddCacheEntry(WORDPTR object, WORDPTR bitmap, UNIFONT const ** font)
+// OBJECTS ARE DECOMPILED DIFFERENTLY WHEN FLAGS OR NUMBER FORMATS CHANGE
+// FORGET ALL ENTRIES IF THE SETTINGS ARE NOT THE ONES THE CACHE WAS RENDERED WITH
+static void uiCheckRenderCacheState()
 {
+    static const BYTE numfmt_name[] = "NumFmt";
+    WORD hash[2], flags[4], state = 0;
+    WORDPTR numfmt;
+    int k;
+
     if(GCFlags & GC_COMPLETED) {
+        // MEMORY WAS REPLACED, NOT COLLECTED
         uiClearRenderCache();
         GCFlags = 0;
     }
 
-    halCacheContents[NEXT_ENTRY * 3] = object;
-    halCacheContents[NEXT_ENTRY * 3 + 1] = bitmap;
-    halCacheContents[NEXT_ENTRY * 3 + 2] = (WORDPTR) font;
-    halCacheEntry = INC_NEXT_ENTRY;
-    if(NEXT_ENTRY == 0)
-        halCacheEntry |= CACHE_FULL;
+    // IGNORE THE STATUS FLAGS, COMMANDS CHANGE THEM ALL THE TIME
+    rplGetSystemFlagsSettings(flags);
+    for(k = 0; k < 4; ++k)
+        state = (state ^ flags[k]) * 16777619U;
+    numfmt = rplGetSettingsbyName((BYTEPTR) numfmt_name,
+            (BYTEPTR) numfmt_name + 6);
+    if(numfmt) {
+        uiObjectHash(numfmt, hash);
+        state ^= hash[1];
+    }
+
+    if(state != halCacheState) {
+        uiClearRenderCache();
+        halCacheState = state;
+    }
 }
 
-void uiUpdateOrAddCacheEntry(WORDPTR object, WORDPTR bitmap, UNIFONT const ** font)
+// FIND THE ENTRY WHERE THE OBJECT IS CACHED, OR -1 IF NOT IN THE CACHE
+static int uiFindCacheSlot(WORD prolog, WORD * hash, UNIFONT const ** font)
 {
-    if(GCFlags & GC_COMPLETED) {
-        uiClearRenderCache();
-        GCFlags = 0;
+    int k, slot;
+
+    for(k = 0; k < RENDERCACHE_PROBES; ++k) {
+        slot = (hash[0] + k) & (MAX_RENDERCACHE_ENTRIES - 1);
+        if(halCacheBitmap[slot] && (halCacheFont[slot] == font)
+                && (halCacheKey[3 * slot] == prolog)
+                && (halCacheKey[3 * slot + 1] == hash[0])
+                && (halCacheKey[3 * slot + 2] == hash[1]))
+            return slot;
     }
+    return -1;
+}
 
-    int k;
-    int limit =
-            (halCacheEntry & CACHE_FULL) ? MAX_RENDERCACHE_ENTRIES : NEXT_ENTRY;
+// STORE A NEW ENTRY, USING A FREE ENTRY IF THERE'S ONE, OTHERWISE REPLACING THEM IN TURN
+static void uiStoreCacheEntry(WORD prolog, WORD * hash, WORDPTR bitmap,
+        UNIFONT const ** font)
+{
+    int k, slot;
 
-    limit *= 3;
+    for(k = 0; k < RENDERCACHE_PROBES; ++k) {
+        slot = (hash[0] + k) & (MAX_RENDERCACHE_ENTRIES - 1);
+        if(!halCacheBitmap[slot])
+            break;
+    }
+    if(k == RENDERCACHE_PROBES) {
+        slot = (hash[0] + halCacheEntry) & (MAX_RENDERCACHE_ENTRIES - 1);
+        halCacheEntry = (halCacheEntry + 1) & (RENDERCACHE_PROBES - 1);
+    }
 
-    for(k = 0; k < limit; k += 3) {
-        if(halCacheContents[k] == object) {
-            halCacheContents[k + 1] = bitmap;
-            halCacheContents[k + 2] = (WORDPTR) font;
-            return;
-        }
+    halCacheBitmap[slot] = bitmap;
+    halCacheFont[slot] = font;
+    halCacheKey[3 * slot] = prolog;
+    halCacheKey[3 * slot + 1] = hash[0];
+    halCacheKey[3 * slot + 2] = hash[1];
+}
 
-    }
+// ADD AN ENTRY TO THE CACHE
+void uiAddCacheEntry(WORDPTR object, WORDPTR bitmap, UNIFONT const ** font)
+{
+    WORD hash[2];
 
-    halCacheContents[NEXT_ENTRY * 3] = object;
-    halCacheContents[NEXT_ENTRY * 3 + 1] = bitmap;
-    halCacheContents[NEXT_ENTRY * 3 + 2] = (WORDPTR) font;
-    halCacheEntry = INC_NEXT_ENTRY;
-    if(NEXT_ENTRY == 0)
-        halCacheEntry |= CACHE_FULL;
+    uiCheckRenderCacheState();
+    uiObjectHash(object, hash);
+    uiStoreCacheEntry(*object, hash, bitmap, font);
 }
 
-// USE AN ENTRY IN THE CACHE
-WORDPTR uiFindCacheEntry(WORDPTR object, UNIFONT const ** font)
+void uiUpdateOrAddCacheEntry(WORDPTR object, WORDPTR bitmap, UNIFONT const ** font)
 {
-    if(GCFlags & GC_COMPLETED) {
-        uiClearRenderCache();
-        GCFlags = 0;
-        return 0;
-    }
+    WORD hash[2];
+    int slot;
 
-    int k;
-    int limit =
-            (halCacheEntry & CACHE_FULL) ? MAX_RENDERCACHE_ENTRIES : NEXT_ENTRY;
+    uiCheckRenderCacheState();
+    uiObjectHash(object, hash);
 
-    limit *= 3;
+    slot = uiFindCacheSlot(*object, hash, font);
+    if(slot >= 0)
+        halCacheBitmap[slot] = bitmap;
+    else
+        uiStoreCacheEntry(*object, hash, bitmap, font);
+}
 
-    for(k = 0; k < limit; k += 3) {
-        if(halCacheContents[k] == object) {
-            if(halCacheContents[k + 2] == (WORDPTR) font)
-                return halCacheContents[k + 1];
-        }
+// USE AN ENTRY IN THE CACHE
+WORDPTR uiFindCacheEntry(WORDPTR object, UNIFONT const ** font)
+{
+    WORD hash[2];
+    int slot;
 
-    }
+    uiCheckRenderCacheState();
+    uiObjectHash(object, hash);
+
+    slot = uiFindCacheSlot(*object, hash, font);
+    if(slot >= 0)
+        return halCacheBitmap[slot];
     return 0;
 }
 
@@ -158,11 +218,17 @@ WORDPTR uiRenderObject(WORDPTR object, UNIFONT const ** font)
 {
 
     // FIRST, CHECK IF THE OBJECT IS IN THE CACHE
+    // KEEP ITS KEY, THE OBJECT MAY MOVE WHILE IT'S BEING RENDERED
+
+    WORD hash[2], prolog = *object;
+    int slot;
 
-    WORDPTR bmp = uiFindCacheEntry(object, font);
+    uiCheckRenderCacheState();
+    uiObjectHash(object, hash);
+    slot = uiFindCacheSlot(prolog, hash, font);
 
-    if(bmp)
-        return bmp;
+    if(slot >= 0)
+        return halCacheBitmap[slot];
 
     // OBJECT WAS NOT IN CACHE, RENDER IT AND ADD IT TO CACHE
 
@@ -215,7 +281,7 @@ WORDPTR uiRenderObject(WORDPTR object, UNIFONT const ** font)
 
         // AND ADD TO CACHE
 
-        uiAddCacheEntry(object, newbmp, font);
+        uiStoreCacheEntry(prolog, hash, newbmp, font);
 
         return newbmp;
 
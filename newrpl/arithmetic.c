@@ -16,6 +16,7 @@
 // EITHER RETURN THE FACTORIAL AS A BINT64 WHEN THE NUMBER IS SMALL ENOUGH
 // OR RETURN THE FACTORIAL ON RReg[0], WHEN THE NUMBER GROWS OUT OF RANGE
 // THE RETURN VALUE IS EITHER -1 OR THE ACTUAL FACTORIAL
+// THIS IS FOR APPROXIMATE ARGUMENTS, EXACT INTEGERS USE rplNewFactorialPush()
 
 BINT64 factorialBINT(BINT n)
 {
@@ -27,6 +28,18 @@ BINT64 factorialBINT(BINT n)
     if(k > n)
         return result;
 
+    // COMPUTE IT EXACTLY IN BINARY AND ROUND ONLY ONCE AT THE END
+    BIGINT fact;
+    if(allocBigInt(&fact)) {
+        if(factorialBigInt(&fact, n)) {
+            newRealFromBigInt(&RReg[0], &fact);
+            freeBigInt(&fact);
+            finalize(&RReg[0]);
+            return -1;
+        }
+        freeBigInt(&fact);
+    }
+
     Context.precdigits += 8;
     newRealFromBINT64(&RReg[0], result, 0);
 
@@ -682,6 +695,87 @@ BINT64 nextprimeBINT(BINT64 n)
     return n;
 }
 
+// TRIAL DIVISION IS ONLY USED AS A QUICK FILTER BEFORE THE PROBABLE PRIME TESTS
+#define PRIME_TRIALLIMIT    1000
+
+// COMPUTE (a*b) MOD m WITHOUT OVERFLOW, FOR ANY m < 2^63
+
+static UBINT64 mulmodBINT64(UBINT64 a, UBINT64 b, UBINT64 m)
+{
+#ifdef __SIZEOF_INT128__
+    return (UBINT64) (((unsigned __int128)a * b) % m);
+#else
+    UBINT64 result = 0;
+
+    a %= m;
+    b %= m;
+    if(!((a | b) >> 32))
+        return (a * b) % m;
+
+    // SHIFT AND ADD, NOTHING CAN OVERFLOW SINCE m < 2^63
+    while(b) {
+        if(b & 1) {
+            result += a;
+            if(result >= m)
+                result -= m;
+        }
+        a <<= 1;
+        if(a >= m)
+            a -= m;
+        b >>= 1;
+    }
+    return result;
+#endif
+}
+
+// COMPUTE a^b MOD m FOR ANY m < 2^63
+
+static UBINT64 powmodUBINT64(UBINT64 a, UBINT64 b, UBINT64 m)
+{
+    UBINT64 result = 1 % m;
+
+    a %= m;
+    while(b) {
+        if(b & 1)
+            result = mulmodBINT64(result, a, m);
+        b >>= 1;
+        if(b)
+            a = mulmodBINT64(a, a, m);
+    }
+    return result;
+}
+
+// STRONG PROBABLE PRIME TEST (MILLER-RABIN) OF n TO BASE a
+// n MUST BE ODD AND LARGER THAN a
+
+static BINT sprpBINT64(UBINT64 n, UBINT64 a)
+{
+    UBINT64 d = n - 1, x;
+    BINT s = 0;
+
+    while(!(d & 1)) {
+        d >>= 1;
+        ++s;
+    }
+
+    x = powmodUBINT64(a, d, n);
+    if((x == 1) || (x == n - 1))
+        return 1;
+
+    while(--s > 0) {
+        x = mulmodBINT64(x, x, n);
+        if(x == n - 1)
+            return 1;
+        if(x == 1)
+            return 0;
+    }
+    return 0;
+}
+
+// THE FIRST 12 PRIMES AS BASES MAKE MILLER-RABIN DETERMINISTIC FOR ALL n < 2^64
+const int primetest_bases[12] =
+        { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+
 BINT isprimeBINT(BINT64 n)
 {
     if(n < 0)
@@ -705,23 +799,322 @@ BINT isprimeBINT(BINT64 n)
         return 0;
     }
 
-    // GENERIC "SLOW" PRIMALITY TEST FOR LARGER NUMBERS
+    // GENERIC PRIMALITY TEST FOR LARGER NUMBERS
 
     if(primesieve_pack[n % 30] < 0)
         return 0;
 
-    // NOW TEST FOR ALL PRIMES, 7 AND UP TO SQRT OF N
+    // QUICKLY DISCARD NUMBERS WITH SMALL FACTORS
     BINT64 i = 7;
 
-    while(i * i <= n) {
+    while(i < PRIME_TRIALLIMIT) {
         if(n % i == 0)
             return 0;
         i = nextcbprimeBINT(i);
     }
 
+    // DETERMINISTIC MILLER-RABIN
+    int k;
+    for(k = 0; k < 12; ++k) {
+        if(!sprpBINT64(n, primetest_bases[k]))
+            return 0;
+    }
+
     return 1;
 }
 
+// RETURN n MOD k FOR AN INTEGER n AND A SMALL k > 0
+// WORKS DIRECTLY ON THE MANTISSA, DOESN'T USE ANY REGISTERS
+
+static BINT smallmodReal(REAL * n, BINT k)
+{
+    UBINT64 r = 0;
+    BINT i, first = 0, div = 1;
+
+    if(n->exp < 0) {
+        // SKIP THE TRAILING ZEROS OF THE INTEGER
+        first = (-n->exp) >> 3;
+        for(i = (-n->exp) & 7; i > 0; --i)
+            div *= 10;
+    }
+
+    for(i = n->len - 1; i > first; --i)
+        r = (r * 100000000 + n->data[i]) % k;
+    if(first < n->len)
+        r = (r * (100000000 / div) + n->data[first] / div) % k;
+
+    if(n->exp > 0)
+        r = mulmodBINT64(r, powmodUBINT64(10, n->exp, k), k);
+
+    return (BINT) r;
+}
+
+// JACOBI SYMBOL (a/n) FOR ODD n > 0
+
+static BINT jacobiBINT64(BINT64 a, BINT64 n)
+{
+    BINT64 tmp;
+    BINT j = 1;
+
+    a %= n;
+    if(a < 0)
+        a += n;
+    while(a) {
+        while(!(a & 1)) {
+            a >>= 1;
+            if(((n & 7) == 3) || ((n & 7) == 5))
+                j = -j;
+        }
+        tmp = a;
+        a = n;
+        n = tmp;
+        if(((a & 3) == 3) && ((n & 3) == 3))
+            j = -j;
+        a %= n;
+    }
+    return (n == 1) ? j : 0;
+}
+
+// JACOBI SYMBOL (a/n) FOR A SMALL ODD a AND A LARGE ODD n > 0
+
+static BINT jacobiReal(BINT a, REAL * n)
+{
+    BINT j = 1, n8 = smallmodReal(n, 8);
+
+    if(a < 0) {
+        a = -a;
+        if((n8 & 3) == 3)
+            j = -j;
+    }
+
+    // QUADRATIC RECIPROCITY
+    if(((a & 3) == 3) && ((n8 & 3) == 3))
+        j = -j;
+
+    return j * jacobiBINT64(smallmodReal(n, a), a);
+}
+
+// RAISE THE PRECISION SO THAT PRODUCTS MODULO n ARE COMPUTED EXACTLY
+// RETURN THE PREVIOUS PRECISION, OR -1 IF n IS TOO LARGE
+
+static BINT modprecReal(REAL * n)
+{
+    BINT saveprec = Context.precdigits;
+    BINT prec = ((2 * intdigitsReal(n)) + 7) & ~7;
+
+    if(prec > MAX_USERPRECISION)
+        return -1;
+    if(prec > Context.precdigits)
+        Context.precdigits = prec;
+    return saveprec;
+}
+
+// COMPUTE result=(a*b) MOD n, ALWAYS POSITIVE
+// USES RReg[3] AND [4], result CAN BE THE SAME AS a OR b
+
+static void mulmodReal(REAL * result, REAL * a, REAL * b, REAL * n)
+{
+    mulReal(&RReg[3], a, b);
+    divmodReal(&RReg[4], result, &RReg[3], n);
+    if(result->flags & F_NEGATIVE)
+        addReal(result, result, n);
+}
+
+// RETURN TRUE IF n IS A PERFECT SQUARE
+// USES RReg[0] TO [4]
+
+static BINT issquareReal(REAL * n)
+{
+    // START FROM 10^CEIL(DIGITS/2) > SQRT(n), NEWTON DECREASES MONOTONICALLY
+    newRealFromBINT(&RReg[0], 1, (intdigitsReal(n) + 1) >> 1);
+    newRealFromBINT(&RReg[4], 5, -1);
+
+    do {
+        divmodReal(&RReg[1], &RReg[2], n, &RReg[0]);
+        addReal(&RReg[3], &RReg[1], &RReg[0]);
+        mulReal(&RReg[1], &RReg[3], &RReg[4]);
+        ipReal(&RReg[3], &RReg[1], 0);
+        if(!ltReal(&RReg[3], &RReg[0]))
+            break;
+        swapReal(&RReg[0], &RReg[3]);
+    }
+    while(1);
+
+    mulReal(&RReg[1], &RReg[0], &RReg[0]);
+    return eqReal(&RReg[1], n);
+}
+
+// STRONG PROBABLE PRIME TEST (MILLER-RABIN) OF A LARGE ODD n TO BASE a
+// PRECISION MUST REPRESENT n^2 EXACTLY
+// USES RReg[0] TO [5] AND 3 TEMPORARY REGISTERS, n CAN'T BE RReg[0] TO [5]
+
+static BINT sprpReal(REAL * n, BINT base)
+{
+    REAL a, d, x;
+    BINT s = 0, result;
+
+    a.data = allocRegister();
+    d.data = allocRegister();
+    x.data = allocRegister();
+
+    // d=(n-1)/2^s
+    newRealFromBINT(&RReg[0], 1, 0);
+    subReal(&d, n, &RReg[0]);
+    newRealFromBINT(&RReg[1], 5, -1);
+    while(!isoddReal(&d)) {
+        mulReal(&d, &d, &RReg[1]);
+        ++s;
+    }
+
+    newRealFromBINT(&a, base, 0);
+    powmodReal(&x, &a, &d, n);
+    if(x.flags & F_NEGATIVE)
+        addReal(&x, &x, n);
+
+    // d=n-1 FROM HERE ON
+    newRealFromBINT(&RReg[0], 1, 0);
+    subReal(&d, n, &RReg[0]);
+
+    result = eqReal(&x, &RReg[0]) || eqReal(&x, &d);
+
+    while(!result && (--s > 0)) {
+        mulmodReal(&x, &x, &x, n);
+        if(eqReal(&x, &d))
+            result = 1;
+        else if(eqReal(&x, &RReg[0]))
+            break;
+    }
+
+    freeRegister(x.data);
+    freeRegister(d.data);
+    freeRegister(a.data);
+
+    return result;
+}
+
+// MAXIMUM NUMBER OF 24-BIT WORDS NEEDED TO STORE n+1 IN BINARY
+#define LUCAS_MAXWORDS  ((MAX_USERPRECISION * 5 / 6) / 24 + 2)
+
+// STRONG LUCAS PROBABLE PRIME TEST OF A LARGE ODD n
+// USES SELFRIDGE'S PARAMETERS: FIRST D IN 5,-7,9,-11,... WITH (D/n)=-1, P=1, Q=(1-D)/4
+// PRECISION MUST REPRESENT n^2 EXACTLY
+// USES RReg[0] TO [5], n CAN'T BE ANY OF THOSE
+
+static BINT slprpReal(REAL * n)
+{
+    WORD bits[LUCAS_MAXWORDS];
+    BINT D = 5, Q, j, k, s, top, nwords;
+
+    // FIND D
+    k = 0;
+    do {
+        j = jacobiReal(D, n);
+        if(j == 0)
+            return 0;   // |D| SHARES A FACTOR WITH n
+        if(j < 0)
+            break;
+        // PERFECT SQUARES NEVER FIND A SUITABLE D
+        if((++k == 10) && issquareReal(n))
+            return 0;
+        D = (D > 0) ? -D - 2 : -D + 2;
+    }
+    while(1);
+    Q = (1 - D) / 4;
+
+    // GET n+1 IN BINARY
+    newRealFromBINT(&RReg[5], 1, 0);
+    addReal(&RReg[0], n, &RReg[5]);
+    newRealFromBINT(&RReg[5], 1 << 24, 0);
+    nwords = 0;
+    do {
+        divmodReal(&RReg[1], &RReg[2], &RReg[0], &RReg[5]);
+        bits[nwords++] = getBINTReal(&RReg[2]);
+        swapReal(&RReg[0], &RReg[1]);
+    }
+    while(!iszeroReal(&RReg[0]) && (nwords < LUCAS_MAXWORDS));
+
+#define LUCAS_BIT(k) ((bits[(k)/24]>>((k)%24))&1)
+
+    // n+1 = d*2^s
+    s = 0;
+    while(!LUCAS_BIT(s))
+        ++s;
+    top = 24 * nwords - 1;
+    while(!LUCAS_BIT(top))
+        --top;
+
+    // RReg[0]=U, RReg[1]=V, RReg[2]=Q^k, START WITH k=1
+    newRealFromBINT(&RReg[0], 1, 0);
+    newRealFromBINT(&RReg[1], 1, 0);
+    newRealFromBINT(&RReg[5], Q, 0);
+    if(Q < 0)
+        addReal(&RReg[2], n, &RReg[5]);
+    else
+        copyReal(&RReg[2], &RReg[5]);
+
+    for(k = top - 1; k >= s; --k) {
+        // DOUBLE k: U=U*V, V=V^2-2*Q^k, Q^k=Q^2k
+        mulmodReal(&RReg[0], &RReg[0], &RReg[1], n);
+        mulmodReal(&RReg[1], &RReg[1], &RReg[1], n);
+        addReal(&RReg[5], &RReg[2], &RReg[2]);
+        subReal(&RReg[1], &RReg[1], &RReg[5]);
+        while(RReg[1].flags & F_NEGATIVE)
+            addReal(&RReg[1], &RReg[1], n);
+        mulmodReal(&RReg[2], &RReg[2], &RReg[2], n);
+
+        if(LUCAS_BIT(k)) {
+            // INCREMENT k: U=(U+V)/2, V=(D*U+V)/2, Q^k=Q^k*Q
+            newRealFromBINT(&RReg[3], D, 0);
+            mulReal(&RReg[4], &RReg[0], &RReg[3]);
+            addReal(&RReg[3], &RReg[4], &RReg[1]);
+            addReal(&RReg[5], &RReg[0], &RReg[1]);
+
+            newRealFromBINT(&RReg[4], 5, -1);
+            if(isoddReal(&RReg[5]))
+                addReal(&RReg[5], &RReg[5], n);
+            mulReal(&RReg[0], &RReg[5], &RReg[4]);
+            if(!ltReal(&RReg[0], n))
+                subReal(&RReg[0], &RReg[0], n);
+
+            divmodReal(&RReg[5], &RReg[1], &RReg[3], n);
+            if(RReg[1].flags & F_NEGATIVE)
+                addReal(&RReg[1], &RReg[1], n);
+            if(isoddReal(&RReg[1]))
+                addReal(&RReg[1], &RReg[1], n);
+            mulReal(&RReg[1], &RReg[1], &RReg[4]);
+
+            newRealFromBINT(&RReg[5], Q, 0);
+            mulmodReal(&RReg[2], &RReg[2], &RReg[5], n);
+        }
+    }
+
+#undef LUCAS_BIT
+
+    // HERE U=U(d), V=V(d)
+    if(iszeroReal(&RReg[0]) || iszeroReal(&RReg[1]))
+        return 1;
+
+    // CHECK V(d*2^r) FOR 0<r<s
+    while(--s > 0) {
+        mulmodReal(&RReg[1], &RReg[1], &RReg[1], n);
+        addReal(&RReg[5], &RReg[2], &RReg[2]);
+        subReal(&RReg[1], &RReg[1], &RReg[5]);
+        while(RReg[1].flags & F_NEGATIVE)
+            addReal(&RReg[1], &RReg[1], n);
+        if(iszeroReal(&RReg[1]))
+            return 1;
+        if(s > 1)
+            mulmodReal(&RReg[2], &RReg[2], &RReg[2], n);
+    }
+
+    return 0;
+}
+
+// PRIMALITY TEST FOR INTEGERS OF ANY SIZE
+// BEYOND 2^63 IT'S A BAILLIE-PSW TEST: MILLER-RABIN TO BASE 2 AND A STRONG LUCAS TEST
+// RAISES ERR_NUMBERTOOBIG IF n CAN'T BE SQUARED AT THE MAXIMUM PRECISION
+// USES RReg[0] TO [5], n CAN'T BE ANY OF THOSE
+
 BINT isprimeReal(REAL * n)
 {
     if(inBINT64Range(n)) {
@@ -733,111 +1126,86 @@ BINT isprimeReal(REAL * n)
 
     // MAKE POSITIVE
     n->flags &= ~F_NEGATIVE;
-    newRealFromBINT(&RReg[2], 30, 0);
-
-    divmodReal(&RReg[0], &RReg[1], n, &RReg[2]);
-
-    BINT rem = getBINTReal(&RReg[1]);   // EXTRACT THE INTEGER REMAINDER
-
-    if(primesieve_pack[rem] < 0)
-        return 0;
 
-    // NOW TEST FOR ALL PRIMES, 7 AND UP TO SQRT OF N
-    BINT64 i = 7;
+    // QUICKLY DISCARD NUMBERS WITH SMALL FACTORS
+    BINT64 i = 2;
 
-    while(i < 3037000500LL) {
-        newRealFromBINT64(&RReg[2], i, 0);
-        divmodReal(&RReg[0], &RReg[1], n, &RReg[2]);
-        if(iszeroReal(&RReg[1]))
+    while(i < PRIME_TRIALLIMIT) {
+        if(!smallmodReal(n, i))
             return 0;
+        i = nextprimeBINT(i);
+    }
 
-        i = nextcbprimeBINT(i);
+    BINT saveprec = modprecReal(n);
+
+    // NUMBERS TOO LARGE TO SQUARE AT MAXIMUM PRECISION CAN'T BE TESTED
+    // CALLERS MUST CHECK FOR EXCEPTIONS, THE RESULT IS NOT A PRIME
+    if(saveprec < 0) {
+        rplError(ERR_NUMBERTOOBIG);
+        return 0;
     }
 
-    // HERE WE TESTED ALL PRIMES UP TO 2^63 AND IT'S STILL PRIME!
+    BINT result = sprpReal(n, 2) && slprpReal(n);
 
-    // TODO: MORE TESTING (FERMAT?)
+    Context.precdigits = saveprec;
 
-    return 1;
+    return result;
 
 }
 
-// USES ALL RReg FROM 0 TO 4 INCLUSIVE
+// USES ALL RReg FROM 0 TO 5 INCLUSIVE
 // RETURN THE NEXT PRIME NUMBER IN RReg[regnum]
 void nextprimeReal(BINT regnum, REAL * n)
 {
+    REAL next;
+    BINT rem, idx, saveprec;
+
     // MAKE POSITIVE
     n->flags &= ~F_NEGATIVE;
 
+    next.data = allocRegister();
+
     if(inBINT64Range(n)) {
         BINT64 nbint = getBINT64Real(n);
-        BINT64 next = nextprimeBINT(nbint);
-        if(next > 0) {
-            newRealFromBINT64(&RReg[regnum], next, 0);
+        BINT64 nextbint = nextprimeBINT(nbint);
+        if(nextbint > 0) {
+            newRealFromBINT64(&RReg[regnum], nextbint, 0);
+            freeRegister(next.data);
             return;
         }
-        // TESTED ALL INTEGERS UP TO 2^63, CONTINUE WITH LARGER ONES???
-        RReg[0].exp = 0;
-        RReg[0].flags = 0;
-        RReg[0].len = 3;
-        RReg[0].data[0] = 54775809;
-        RReg[0].data[1] = 33720368;
-        RReg[0].data[2] = 922;
+        // TESTED ALL INTEGERS UP TO 2^63, CONTINUE WITH LARGER ONES
+        next.exp = 0;
+        next.flags = 0;
+        next.len = 3;
+        next.data[0] = 54775807;
+        next.data[1] = 33720368;
+        next.data[2] = 922;
 
     }
     else
-        copyReal(&RReg[0], n);
-
-    newRealFromBINT(&RReg[2], 30, 0);
+        copyReal(&next, n);
 
-    BINT64 i = 0;
+    saveprec = modprecReal(&next);
+    if(saveprec < 0) {
+        rplError(ERR_NUMBERTOOBIG);
+        freeRegister(next.data);
+        return;
+    }
 
     do {
-
-        divmodReal(&RReg[3], &RReg[1], &RReg[0], &RReg[2]);
-
-        BINT rem = getBINTReal(&RReg[1]);       // EXTRACT THE INTEGER REMAINDER
-
-        if(primesieve_pack[rem] < 0) {
-            // NOT PRIME, NEXT
-            BINT idx = primesieve_nextpack[rem];
-            // THIS IS LOW-LEVEL ACCESS TO DECIMAL LIBRARY FOR SPEED
-            RReg[0].data[0] -= rem;
-            RReg[0].data[0] += 30 * (idx >> 3);
-            RReg[0].data[0] += primesieve_unpack[idx & 7];
-            normalize(&RReg[0]);
-            continue;
-        }
-
-        // NOW TEST FOR ALL PRIMES, 7 AND UP TO SQRT OF N
-        i = 7;
-
-        while(i < 3037000500LL) {
-            newRealFromBINT64(&RReg[4], i, 0);
-            divmodReal(&RReg[3], &RReg[1], &RReg[0], &RReg[4]);
-            if(iszeroReal(&RReg[1])) {
-                // NOT PRIME, NEXT
-                rem = getBINTReal(&RReg[1]);    // EXTRACT THE INTEGER REMAINDER
-                BINT idx = primesieve_nextpack[rem];
-                // THIS IS LOW-LEVEL ACCESS TO DECIMAL LIBRARY FOR SPEED
-                RReg[0].data[0] -= rem;
-                RReg[0].data[0] += 30 * (idx >> 3);
-                RReg[0].data[0] += primesieve_unpack[idx & 7];
-                normalize(&RReg[0]);
-                break;
-            }
-
-            i = nextcbprimeBINT(i);
-        }
-
-        // HERE WE TESTED ALL PRIMES UP TO 2^63 AND IT'S STILL PRIME!
-
-        // TODO: MORE TESTING (FERMAT?)
+        // SKIP TO THE NEXT NUMBER NOT DIVISIBLE BY 2, 3 OR 5
+        rem = smallmodReal(&next, 30);
+        idx = primesieve_nextpack[rem];
+        newRealFromBINT(&RReg[0],
+                30 * (idx >> 3) + primesieve_unpack[idx & 7] - rem, 0);
+        addReal(&next, &next, &RReg[0]);
     }
-    while(i < 3037000500LL);
+    while(!isprimeReal(&next) && !Exceptions);
+
+    Context.precdigits = saveprec;
 
-    if(regnum != 0)
-        swapReal(&RReg[regnum], &RReg[0]);
+    copyReal(&RReg[regnum], &next);
+    freeRegister(next.data);
 }
 
 // COMPUTE a^b MOD mod
@@ -965,6 +1333,9 @@ void powmodReal(REAL * result, REAL * a, REAL * b, REAL * mod)
 
 void gcdReal(REAL * result, REAL * a, REAL * b)
 {
+    // TRY EXACT BINARY ARITHMETIC FIRST
+    if(egcdReal(result, 0, 0, a, b))
+        return;
 
     copyReal(&RReg[0], a);
     copyReal(&RReg[1], b);
@@ -1000,6 +1371,86 @@ void gcdReal(REAL * result, REAL * a, REAL * b)
     swapReal(&RReg[0], result);
 }
 
+// GREATEST COMMON DIVISOR OF 2 INTEGERS USING BINARY BIG INTEGERS
+// IF s AND t ARE GIVEN, ALSO RETURN THE BEZOUT COEFFICIENTS gcd=s*a+t*b
+// AS OBTAINED FROM THE EXTENDED EUCLIDEAN ALGORITHM, WHICH NEEDS a>=b>0
+// RETURN 0 IF THE NUMBERS ARE TOO LARGE OR THERE'S NO STORAGE
+
+BINT egcdReal(REAL * gcd, REAL * s, REAL * t, REAL * a, REAL * b)
+{
+    BIGINT u, v, q, s1, s2, prod;
+    BINT ok = 0;
+
+    if(!allocBigInt(&u))
+        return 0;
+    if(!allocBigInt(&v)) {
+        freeBigInt(&u);
+        return 0;
+    }
+
+    if(!newBigIntFromReal(&u, a) || !newBigIntFromReal(&v, b)) {
+        freeBigInt(&v);
+        freeBigInt(&u);
+        return 0;
+    }
+    u.flags = v.flags = 0;
+
+    if(!s) {
+        gcdBigInt(&u, &v);
+        newRealFromBigInt(gcd, &u);
+        normalize(gcd);
+        freeBigInt(&v);
+        freeBigInt(&u);
+        return 1;
+    }
+
+    // THE COEFFICIENTS GROW UP TO THE SIZE OF a*b
+    if(2 * u.len <= BIGINT_MAXWORDS) {
+        if(allocBigInt(&q)) {
+            if(allocBigInt(&s1)) {
+                if(allocBigInt(&s2)) {
+                    if(allocBigInt(&prod)) {
+                        newBigIntFromBINT64(&s1, 1);
+                        newBigIntFromBINT64(&s2, 0);
+                        // ONLY THE COEFFICIENT OF a IS TRACKED
+                        while(v.len) {
+                            divmodBigInt(&q, &u, &v);
+                            mulBigInt(&prod, &q, &s2);
+                            subBigInt(&s1, &s1, &prod);
+                            swapBigInt(&u, &v);
+                            swapBigInt(&s1, &s2);
+                        }
+                        // t=(gcd-s*a)/b
+                        newBigIntFromReal(&v, a);
+                        v.flags = 0;
+                        mulBigInt(&prod, &s1, &v);
+                        subBigInt(&q, &u, &prod);
+                        newBigIntFromReal(&v, b);
+                        v.flags = 0;
+                        divmodBigInt(&prod, &q, &v);
+
+                        newRealFromBigInt(gcd, &u);
+                        normalize(gcd);
+                        newRealFromBigInt(s, &s1);
+                        normalize(s);
+                        newRealFromBigInt(t, &prod);
+                        normalize(t);
+                        ok = 1;
+                        freeBigInt(&prod);
+                    }
+                    freeBigInt(&s2);
+                }
+                freeBigInt(&s1);
+            }
+            freeBigInt(&q);
+        }
+    }
+
+    freeBigInt(&v);
+    freeBigInt(&u);
+    return ok;
+}
+
 BINT64 gcdBINT64(BINT64 a, BINT64 b)
 {
     BINT64 tmp;
@@ -1031,239 +1482,205 @@ BINT64 sqrtBINT64(BINT64 num)
     return nshifted;
 }
 
-// RETURN ONE NON-TRIVIAL FACTOR OF n
-// RETURNS n IF n IS PRIME
-// USES POLLARD'S RHO ALGORITHM
-// n CAN'T BE RREG[0] TO [4]  OR [7] TO [9]
-// RETURNS THE FACTOR AS A BINT64 OR -1 AND THE RESULT IN result
+// POLLARD'S RHO WITH BRENT'S CYCLE DETECTION AND g(x)=x^2+c
+// THE PRODUCT OF |x-y| IS ACCUMULATED AND ONLY ONE GCD IS DONE EVERY GCD_BATCH STEPS
 
-#define GIVEUP_PRIME    1000
-#define GIVEUP_ITERATIONS 2000
+#define GCD_BATCH           100
+#define GIVEUP_ITERATIONS   (1 << 18)
+#define GIVEUP_POLYNOMIALS  8
 
-BINT64 factorReal(REAL * result, REAL * n)
+// RETURN A NON-TRIVIAL FACTOR OF n, 0 IF THE POLYNOMIAL FAILED OR -1 TO GIVE UP
+
+static BINT64 brentBINT64(UBINT64 n, UBINT64 c)
 {
-    BINT64 startnum = 2, x, y, ni, d = 1, itercnt;
+    UBINT64 x, y = 2, ys, q = 1, g = 1, r = 1, k, i, m;
 
-    if(inBINT64Range(n))
-        ni = getBINT64Real(n);
-    else
-        ni = -1;
+#define BRENT_STEP(v) { v = mulmodBINT64(v, v, n) + c; if(v >= n) v -= n; }
 
     do {
+        x = y;
+        for(i = 0; i < r; ++i)
+            BRENT_STEP(y);
+        k = 0;
+        do {
+            ys = y;
+            m = (r - k < GCD_BATCH) ? r - k : GCD_BATCH;
+            for(i = 0; i < m; ++i) {
+                BRENT_STEP(y);
+                q = mulmodBINT64(q, (x > y) ? x - y : y - x, n);
+            }
+            g = gcdBINT64(q, n);
+            k += m;
+        }
+        while((k < r) && (g == 1));
+        r <<= 1;
+    }
+    while((g == 1) && (r <= GIVEUP_ITERATIONS));
+
+    if(g == 1)
+        return -1;
 
-        x = y = startnum;
-        itercnt = 0;
+    if(g == n) {
+        // THE BATCH OVERSHOT, REDO IT ONE STEP AT A TIME
         do {
+            BRENT_STEP(ys);
+            g = gcdBINT64((x > ys) ? x - ys : ys - x, n);
+        }
+        while(g == 1);
+    }
 
-            // do x=g(x) with g(x)=x^2+1
-
-            if(x >= (1LL << 31)) {
-                // SWITCH TO REALS
-                newRealFromBINT64(&RReg[8], x, 0);
-                x = -1;
-                mulReal(&RReg[1], &RReg[8], &RReg[8]);
-                divmodReal(&RReg[8], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=x^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[8], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[8], n)) {
-                    RReg[8].data[0] = 0;
-                    RReg[8].exp = 0;
-                    RReg[8].flags = 0;
-                    RReg[8].len = 1;
-                }
-                // HERE RReg[8]= (x^2+1) mod n
+#undef BRENT_STEP
 
-            }
-            else if(x < 0) {
-                // ALREADY USING REALS, x IS IN RReg[8]
-                mulReal(&RReg[1], &RReg[8], &RReg[8]);
-                divmodReal(&RReg[8], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=x^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[8], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[8], n)) {
-                    RReg[8].data[0] = 0;
-                    RReg[8].exp = 0;
-                    RReg[8].flags = 0;
-                    RReg[8].len = 1;
-                }
-                // HERE RReg[8]= (x^2+1) mod n
+    if(g == n)
+        return 0;
+    return g;
+}
 
-            }
-            else {
-                x = (x * x + 1);
-                if((ni > 0) && (ni <= x))
-                    x = x % ni;
-            }
+// DO x=(x^2+c) MOD n
+// USES RReg[3] AND [4]
 
-            // HERE EITHER x OR RReg[8] HAVE x=g(x) MOD n
-
-            // do y=g(g(y)) with g(x)=x^2+1
-
-            if(y >= (1LL << 31)) {
-                // SWITCH TO REALS
-                newRealFromBINT64(&RReg[9], y, 0);
-                y = -1;
-                mulReal(&RReg[1], &RReg[9], &RReg[9]);
-                divmodReal(&RReg[9], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=y^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[9], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[9], n)) {
-                    RReg[9].data[0] = 0;
-                    RReg[9].exp = 0;
-                    RReg[9].flags = 0;
-                    RReg[9].len = 1;
-                }
-                // HERE RReg[9]= (y^2+1) mod n
+static void brentstepReal(REAL * x, REAL * n, BINT c)
+{
+    mulmodReal(x, x, x, n);
+    newRealFromBINT(&RReg[3], c, 0);
+    addReal(x, x, &RReg[3]);
+    if(!ltReal(x, n))
+        subReal(x, x, n);
+}
 
-            }
-            else if(y < 0) {
-                // ALREADY USING REALS, y IS IN RReg[9]
-                mulReal(&RReg[1], &RReg[9], &RReg[9]);
-                divmodReal(&RReg[9], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=y^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[9], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[9], n)) {
-                    RReg[9].data[0] = 0;
-                    RReg[9].exp = 0;
-                    RReg[9].flags = 0;
-                    RReg[9].len = 1;
-                }
-                // HERE RReg[9]= (y^2+1) mod n
+// SAME AS brentBINT64 FOR LARGE INTEGERS, PRECISION MUST REPRESENT n^2 EXACTLY
+// RETURNS THE FACTOR IN RReg[5]
+// USES RReg[0] TO [5] AND 4 TEMPORARY REGISTERS, n CAN'T BE ANY OF THOSE
 
-            }
-            else {
-                y = (y * y + 1);
-                if((ni > 0) && (ni <= y))
-                    y = y % ni;
-            }
+static BINT brentReal(REAL * n, BINT c)
+{
+    REAL x, y, ys, q;
+    BINT r = 1, k, i, m, result;
 
-            if(y >= (1LL << 31)) {
-                // SWITCH TO REALS
-                newRealFromBINT64(&RReg[9], y, 0);
-                y = -1;
-                mulReal(&RReg[1], &RReg[9], &RReg[9]);
-                divmodReal(&RReg[9], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=y^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[9], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[9], n)) {
-                    RReg[9].data[0] = 0;
-                    RReg[9].exp = 0;
-                    RReg[9].flags = 0;
-                    RReg[9].len = 1;
-                }
-                // HERE RReg[9]= (y^2+1) mod n
+    x.data = allocRegister();
+    y.data = allocRegister();
+    ys.data = allocRegister();
+    q.data = allocRegister();
 
-            }
-            else if(y < 0) {
-                // ALREADY USING REALS, y IS IN RReg[9]
-                mulReal(&RReg[1], &RReg[9], &RReg[9]);
-                divmodReal(&RReg[9], &RReg[2], &RReg[1], n);
-                // HERE RReg[2]=y^2 MOD n
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                addReal(&RReg[9], &RReg[2], &RReg[1]);
-                if(eqReal(&RReg[9], n)) {
-                    RReg[9].data[0] = 0;
-                    RReg[9].exp = 0;
-                    RReg[9].flags = 0;
-                    RReg[9].len = 1;
-                }
-                // HERE RReg[9]= (y^2+1) mod n
+#define BRENT_ISONE(v) (inBINT64Range(v) && (getBINT64Real(v) == 1))
+
+    newRealFromBINT(&y, 2, 0);
+    newRealFromBINT(&q, 1, 0);
 
+    do {
+        copyReal(&x, &y);
+        for(i = 0; i < r; ++i)
+            brentstepReal(&y, n, c);
+        k = 0;
+        do {
+            copyReal(&ys, &y);
+            m = (r - k < GCD_BATCH) ? r - k : GCD_BATCH;
+            for(i = 0; i < m; ++i) {
+                brentstepReal(&y, n, c);
+                subReal(&RReg[0], &x, &y);
+                RReg[0].flags &= ~F_NEGATIVE;
+                mulmodReal(&q, &q, &RReg[0], n);
             }
-            else {
-                y = (y * y + 1);
-                if((ni > 0) && (ni <= y))
-                    y = y % ni;
+            gcdReal(&RReg[5], &q, n);
+            RReg[5].flags &= ~F_NEGATIVE;
+            k += m;
+        }
+        while((k < r) && BRENT_ISONE(&RReg[5]));
+        r <<= 1;
+    }
+    while(BRENT_ISONE(&RReg[5]) && (r <= GIVEUP_ITERATIONS));
+
+    if(BRENT_ISONE(&RReg[5]))
+        result = -1;
+    else {
+        if(eqReal(&RReg[5], n)) {
+            // THE BATCH OVERSHOT, REDO IT ONE STEP AT A TIME
+            do {
+                brentstepReal(&ys, n, c);
+                subReal(&q, &x, &ys);
+                q.flags &= ~F_NEGATIVE;
+                gcdReal(&RReg[5], &q, n);
+                RReg[5].flags &= ~F_NEGATIVE;
             }
+            while(BRENT_ISONE(&RReg[5]));
+        }
+        result = eqReal(&RReg[5], n) ? 0 : 1;
+    }
 
-            // HERE EITHER y OR RReg[9] HAVE y=g(g(y)) MOD n
-
-            // DO d=gcd(abs(x-y),n)
-            if((x < 0) || (y < 0) || (ni < 0)) {
-                if(x >= 0)
-                    newRealFromBINT64(&RReg[8], x, 0);
-                if(y >= 0)
-                    newRealFromBINT64(&RReg[9], y, 0);
-
-                subReal(&RReg[4], &RReg[8], &RReg[9]);
-                RReg[4].flags &= ~F_NEGATIVE;
+#undef BRENT_ISONE
 
-                gcdReal(&RReg[3], &RReg[4], n);
+    freeRegister(q.data);
+    freeRegister(ys.data);
+    freeRegister(y.data);
+    freeRegister(x.data);
 
-                if(inBINT64Range(&RReg[3]))
-                    d = getBINT64Real(&RReg[3]);
-                else {
-                    d = -1;
-                    swapReal(&RReg[3], &RReg[7]);
-                }
+    return result;
+}
 
-            }
-            else {
-                // ALL INTEGERS HERE
-                BINT64 tmp = x - y;
-                if(tmp < 0)
-                    tmp = -tmp;
-                d = gcdBINT64(tmp, ni);
-            }
+// RETURN ONE PRIME FACTOR OF n
+// RETURNS n IF n IS PRIME, OR 1 IF NO FACTOR COULD BE FOUND
+// USES POLLARD-BRENT'S RHO ALGORITHM
+// n AND result CAN'T BE RREG[0] TO [5]
+// RETURNS THE FACTOR AS A BINT64 OR -1 AND THE RESULT IN result
 
-            // here d OR RReg[7] HAS gcd(abs(x-y),n)
+BINT64 factorReal(REAL * result, REAL * n)
+{
+    BINT64 ni, d;
+    BINT c, saveprec;
 
-            if(d < 0) {
-                RReg[1].data[0] = 1;
-                RReg[1].exp = 0;
-                RReg[1].flags = 0;
-                RReg[1].len = 1;
-                if(!eqReal(&RReg[1], &RReg[7]))
+    if(inBINT64Range(n)) {
+        ni = getBINT64Real(n);
+        if(ni < 0)
+            ni = -ni;
+        if(ni < 4)
+            return ni;
+
+        // KEEP SPLITTING UNTIL THE FACTOR IS PRIME
+        while(!isprimeBINT(ni)) {
+            for(c = 1; c <= GIVEUP_POLYNOMIALS; ++c) {
+                d = brentBINT64(ni, c);
+                if(d)
                     break;
             }
-            ++itercnt;
+            if(d <= 0)
+                return 1;
+            ni = d;
         }
-        while((d <= 1) && (itercnt < GIVEUP_ITERATIONS));
+        return ni;
+    }
 
-        if(d < 0) {
-            if(ni > 0)
-                newRealFromBINT64(&RReg[0], ni, 0);
+    saveprec = modprecReal(n);
+    if(saveprec < 0)
+        return 1;
 
-            if(!eqReal(&RReg[7], &RReg[0]))
-                break;
+    copyReal(result, n);
+    result->flags &= ~F_NEGATIVE;
+
+    // KEEP SPLITTING UNTIL THE FACTOR IS PRIME
+    while(!isprimeReal(result)) {
+        if(Exceptions) {
+            Context.precdigits = saveprec;
+            return 1;
         }
-        else {
-            if(d != ni)
-                break;
+        if(inBINT64Range(result)) {
+            Context.precdigits = saveprec;
+            return factorReal(result, result);
         }
 
-        // d==n --> FAILURE, TRY ANOTHER STARTING POINT
-        startnum = nextprimeBINT(startnum);
-
+        for(c = 1; c <= GIVEUP_POLYNOMIALS; ++c) {
+            d = brentReal(result, c);
+            if(d)
+                break;
+        }
+        if(d <= 0) {
+            Context.precdigits = saveprec;
+            return 1;
+        }
+        swapReal(result, &RReg[5]);
     }
-    while((startnum < GIVEUP_PRIME) && !((ni > 0) && (startnum > ni)));
 
-    if(d < 0)
-        swapReal(result, &RReg[7]);
+    Context.precdigits = saveprec;
 
-    return d;
+    return -1;
 
 }
@@ -66,6 +66,32 @@ void trig_atan2(REAL *, REAL *, BINT angmode);
 void trig_asin(REAL *, BINT angmode);
 void trig_acos(REAL *, BINT angmode);
 
+// SAME FUNCTIONS USING AN EXPLICIT CONTEXT, RESULTS IN ITS OWN RReg[]
+
+void hyp_expCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_expmCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_lnCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_lnp1Ctx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_logCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_powCtx(DECIMAL_CONTEXT * ctx, REAL * x, REAL * a);
+void hyp_sqrtCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_sinhcoshCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_tanhCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_sinhCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_coshCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_atanhCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_asinhCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void hyp_acoshCtx(DECIMAL_CONTEXT * ctx, REAL * x);
+void trig_sincosCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode);
+void trig_sinCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode);
+void trig_cosCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode);
+void trig_tanCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode);
+void trig_atan2Ctx(DECIMAL_CONTEXT * ctx, REAL * y, REAL * x, BINT angmode);
+void trig_asinCtx(DECIMAL_CONTEXT * ctx, REAL * x, BINT angmode);
+void trig_acosCtx(DECIMAL_CONTEXT * ctx, REAL * x, BINT angmode);
+void powRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * x, REAL * a);
+void xrootRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * x, REAL * a);
+
 BINT64 factorialBINT(BINT n);
 BINT64 nextcbprimeBINT(BINT64 n);
 BINT64 nextprimeBINT(BINT64 n);
@@ -77,6 +103,7 @@ BINT64 powmodBINT(BINT64 a, BINT64 b, BINT64 mod);
 void powmodReal(REAL * result, REAL * a, REAL * b, REAL * mod);
 
 void gcdReal(REAL * result, REAL * a, REAL * b);
+BINT egcdReal(REAL * gcd, REAL * s, REAL * t, REAL * a, REAL * b);
 BINT64 gcdBINT64(BINT64 a, BINT64 b);
 BINT64 sqrtBINT64(BINT64 num);
 BINT64 factorReal(REAL * result, REAL * n);
@@ -5,6 +5,7 @@
  * See the file LICENSE.txt that shipped with this distribution.
  */
 
+#include "hal_api.h"
 #include "libraries.h"
 #include "newrpl.h"
 #include "sysvars.h"
@@ -531,6 +532,10 @@ BINT rplRestoreBackup(BINT includestack, WORD(*readfunc) (void *),
         return -1;
 
     DirsTop = Directories + sections[3].nitems;
+    rplClearDirIndex();
+    rplClearListIndex();
+    rplClearSymbCache();
+    uiClearRenderCache();
 
     while(offset < sections[4].offwords) {
         readfunc(OpaqueArgument);
@@ -62,6 +62,149 @@ WORDPTR rplCompileAppendWords(BINT nwords)
     return CompileEnd - nwords;
 }
 
+// COMMAND NAME INDEX
+// LIBRARIES THAT ONLY COMPILE THEIR OWN COMMAND NAMES REPORT THEM DURING
+// INSTALLATION, SO THE COMPILER CAN FIND WHICH LIBRARY OWNS A TOKEN WITH
+// A SINGLE HASH LOOKUP INSTEAD OF OFFERING THE TOKEN TO EVERY LIBRARY.
+// ALL OTHER LIBRARIES (NUMBERS, STRINGS, IDENTS, CONSTRUCTS) ARE STILL PROBED
+
+static WORD rplCmdIndexHash(BYTEPTR start, BYTEPTR end)
+{
+    WORD hash = 115127;
+    while(start < end) {
+        hash = ((hash << 13) - hash) + *start;
+        ++start;
+    }
+    return (hash ^ (hash >> 16)) & (CMDINDEXBUCKETS - 1);
+}
+
+// REBUILD ALL THE HASH CHAINS FROM THE LIST OF ENTRIES
+static void rplRehashCmdIndex()
+{
+    BINT k;
+    WORD hash;
+    const char *name;
+
+    for(k = 0; k < CMDINDEXBUCKETS; ++k)
+        CmdIndexBuckets[k] = 0;
+
+    for(k = 0; k < CmdIndexUsed; ++k) {
+        name = CmdIndex[k].name;
+        hash = rplCmdIndexHash((BYTEPTR) name,
+                (BYTEPTR) name + stringlen((char *)name));
+        CmdIndex[k].next = CmdIndexBuckets[hash];
+        CmdIndexBuckets[hash] = k + 1;
+    }
+}
+
+void rplClearCmdIndex()
+{
+    BINT k;
+    for(k = 0; k < CMDINDEXBUCKETS; ++k)
+        CmdIndexBuckets[k] = 0;
+    for(k = 0; k < (MAXLIBNUMBER + 1) / 32; ++k)
+        CmdIndexedLibs[k] = 0;
+    CmdIndexUsed = 0;
+    NumCompileProbeLibs = 0;
+}
+
+// ADD ALL COMMANDS OF A LIBRARY TO THE INDEX
+// IF THE INDEX IS FULL THE LIBRARY IS LEFT OUT AND WILL BE PROBED NORMALLY
+void rplAddCmdIndex(BINT libnum, char *libnames[], BINT numcmds)
+{
+    BINT k;
+    WORD hash;
+
+    if((libnum < 0) || (libnum > MAXLIBNUMBER))
+        return;
+    if(CmdIndexedLibs[libnum >> 5] & (1 << (libnum & 31)))
+        return; // ALREADY INDEXED
+    if(CmdIndexUsed + numcmds > MAXCMDINDEX)
+        return;
+
+    for(k = 0; k < numcmds; ++k) {
+        if(!libnames[k] || !*libnames[k])
+            continue;   // NO NAME = CANNOT BE COMPILED
+        CmdIndex[CmdIndexUsed].name = libnames[k];
+        CmdIndex[CmdIndexUsed].libnum = libnum;
+        hash = rplCmdIndexHash((BYTEPTR) libnames[k],
+                (BYTEPTR) libnames[k] + stringlen(libnames[k]));
+        CmdIndex[CmdIndexUsed].next = CmdIndexBuckets[hash];
+        CmdIndexBuckets[hash] = CmdIndexUsed + 1;
+        ++CmdIndexUsed;
+    }
+
+    CmdIndexedLibs[libnum >> 5] |= 1 << (libnum & 31);
+}
+
+// REMOVE ALL COMMANDS OF A LIBRARY FROM THE INDEX
+void rplRemoveCmdIndex(BINT libnum)
+{
+    BINT k, j;
+
+    if((libnum < 0) || (libnum > MAXLIBNUMBER))
+        return;
+    if(!(CmdIndexedLibs[libnum >> 5] & (1 << (libnum & 31))))
+        return;
+
+    for(k = 0, j = 0; k < CmdIndexUsed; ++k) {
+        if(CmdIndex[k].libnum == libnum)
+            continue;
+        CmdIndex[j++] = CmdIndex[k];
+    }
+    CmdIndexUsed = j;
+    CmdIndexedLibs[libnum >> 5] &= ~(1 << (libnum & 31));
+
+    rplRehashCmdIndex();
+}
+
+// REBUILD THE LIST OF LIBRARIES THAT NEED TO BE PROBED FOR EVERY TOKEN
+// MUST BE CALLED AFTER ANY LIBRARY IS INSTALLED OR REMOVED
+void rplUpdateCompileProbeLibs()
+{
+    BINT libnum = MAXLIBNUMBER;
+
+    NumCompileProbeLibs = 0;
+
+    while(libnum >= 0) {
+        if(rplGetLibHandler(libnum)
+                && !(CmdIndexedLibs[libnum >> 5] & (1 << (libnum & 31))))
+            CompileProbeLibs[NumCompileProbeLibs++] = libnum;
+        libnum = rplGetNextLib(libnum);
+    }
+}
+
+// FIND ALL INDEXED LIBRARIES THAT HAVE A COMMAND WITH THE GIVEN NAME
+// STORES UP TO maxlibs LIBRARY NUMBERS IN libs, SORTED FROM HIGH TO LOW
+// RETURNS THE NUMBER OF LIBRARIES FOUND, OR -1 IF THERE WERE MORE THAN maxlibs
+BINT rplFindCmdIndex(BYTEPTR start, BYTEPTR end, BINT * libs, BINT maxlibs)
+{
+    BINT nlibs = 0, k, len = end - start;
+    HALFWORD entry = CmdIndexBuckets[rplCmdIndexHash(start, end)];
+    const char *name;
+
+    while(entry) {
+        name = CmdIndex[entry - 1].name;
+        for(k = 0; k < len; ++k)
+            if(name[k] != (char)start[k])
+                break;
+        if((k == len) && !name[k]) {
+            if(nlibs >= maxlibs)
+                return -1;
+            // INSERT SORTED, HIGHEST LIBRARY FIRST
+            k = nlibs;
+            while((k > 0) && (libs[k - 1] < CmdIndex[entry - 1].libnum)) {
+                libs[k] = libs[k - 1];
+                --k;
+            }
+            libs[k] = CmdIndex[entry - 1].libnum;
+            ++nlibs;
+        }
+        entry = CmdIndex[entry - 1].next;
+    }
+    return nlibs;
+}
+
 // REVERSE-SKIP AN OBJECT, FROM A POINTER TO AFTER THE OBJECT TO SKIP
 // NO ARGUMENT CHECKS, DO NOT CALL UNLESS THERE'S A VALID OBJECT LIST
 WORDPTR rplReverseSkipOb(WORDPTR list_start, WORDPTR after_object)
@@ -169,6 +312,7 @@ WORDPTR rplCompile(BYTEPTR string, BINT length, BINT addwrapper)
     BINT probe_libnum = 0, probe_tokeninfo = 0, previous_tokeninfo;
     LIBHANDLER handler, ValidateHandler;
     BINT libcnt, libnum;
+    BINT useindex, probeidx = 0, cmdidx = 0, ncmdlibs = 0, cmdlibs[4];
     WORDPTR InfixOpTop = 0;
 
     LAMTopSaved = LAMTop;       // SAVE LAM ENVIRONMENT
@@ -229,31 +373,59 @@ WORDPTR rplCompile(BYTEPTR string, BINT length, BINT addwrapper)
         CurrentConstruct = (BINT) ((ValidateTop > ValidateBottom) ? **(ValidateTop - 1) : 0);   // CARRIES THE WORD OF THE CURRENT CONSTRUCT/COMPOSITE
         ValidateHandler = rplGetLibHandler(LIBNUM(CurrentConstruct));
         LastCompiledObject = CompileEnd;
-        if(force_libnum < 0) {
+        if(TokenStart >= CompileStringEnd)
+            break;
+
+        // TOKENS COMPILED OUTSIDE OF SYMBOLICS CAN USE THE COMMAND INDEX
+        // SYMBOLICS NEED ALL LIBRARIES TO PROBE FOR THE LONGEST MATCH
+        useindex = (force_libnum < 0) && !infixmode;
+
+        if(useindex) {
+            // ONLY OFFER THE TOKEN TO LIBRARIES THAT NEED PROBING AND TO THE LIBRARIES THAT HAVE A COMMAND WITH THIS NAME, FROM HIGH TO LOW
+            ncmdlibs =
+                    rplFindCmdIndex((BYTEPTR) TokenStart, (BYTEPTR) BlankStart,
+                    cmdlibs, 4);
+            if(ncmdlibs < 0)
+                useindex = 0;   // TOO MANY LIBRARIES USE THIS NAME, DO A FULL SCAN
+            probeidx = cmdidx = 0;
+        }
+
+        if(useindex)
+            libcnt = 0;
+        else if(force_libnum < 0) {
             // SCAN THROUGH ALL THE LIBRARIES, FROM HIGH TO LOW, TO SEE WHICH ONE WANTS THE TOKEN
             libcnt = MAXLIBNUMBER;
         }
         else
             libcnt = 0; // EXECUTE THE LOOP ONLY ONCE
 
-        if(TokenStart >= CompileStringEnd)
-            break;
-
         if(infixmode) {
             probe_libnum = -1;
             probe_tokeninfo = 0;
         }
 
         while(libcnt >= 0) {
-            if(force_libnum < 0) {
+            if(useindex) {
+                // MERGE BOTH LISTS
+                if((probeidx < NumCompileProbeLibs) && ((cmdidx >= ncmdlibs)
+                            || (CompileProbeLibs[probeidx] > cmdlibs[cmdidx])))
+                    libnum = CompileProbeLibs[probeidx++];
+                else if(cmdidx < ncmdlibs)
+                    libnum = cmdlibs[cmdidx++];
+                else
+                    break;      // NO MORE LIBRARIES TO PROBE
+                handler = rplGetLibHandler(libnum);
+            }
+            else if(force_libnum < 0) {
                 libnum = libcnt;
                 handler = rplGetLibHandler(libcnt);
+                libcnt = rplGetNextLib(libcnt);
             }
             else {
                 libnum = force_libnum;
                 handler = rplGetLibHandler(force_libnum);
+                libcnt = rplGetNextLib(libcnt);
             }
-            libcnt = rplGetNextLib(libcnt);
 
             if(!handler)
                 continue;
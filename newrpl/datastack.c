@@ -24,8 +24,12 @@ void growDStk(WORD newtotalsize)
         newdstk = halGrowMemory(MEM_AREA_DSTK, DStk, newtotalsize);
 
         if(!newdstk) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                if(gc_done)
+                    rplGCollect();
+                else
+                    rplGCollectMinor();
                 ++gc_done;
             }
             else {
@@ -96,8 +100,8 @@ void rplExpandStack(BINT numobjects)
     if(DStkSize <=
             (BINT) ((DSTop - DStk + numobjects +
                     DSTKSLACK) * sizeof(WORDPTR) / sizeof(WORD)))
-        growDStk((DSTop - DStk + numobjects + DSTKSLACK) * sizeof(WORDPTR) +
-                sizeof(WORD));
+        growDStk((DSTop - DStk + numobjects +
+                    DSTKSLACK) * sizeof(WORDPTR) / sizeof(WORD));
     if(Exceptions)
         return;
 }
@@ -25,6 +25,38 @@ void initContext(WORD precision)
     //Context.alloc_bmp=EMPTY_STORAGEBMP;
 }
 
+// PREPARE A NEW CONTEXT WITH ITS OWN REGISTERS
+
+void initDecimalContext(DECIMAL_CONTEXT * ctx, WORD precision)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    int k;
+
+    Context.alloc_bmp = EMPTY_STORAGEBMP;
+    Context.recipdivlen = 0;
+    initContext(precision);
+
+    for(k = 0; k < REAL_REGISTERS; ++k) {
+        RReg[k].data = allocRegister();
+        RReg[k].data[0] = 0;
+        RReg[k].flags = 0;
+        RReg[k].exp = 0;
+        RReg[k].len = 1;
+    }
+
+    selectContext(prev);
+}
+
+// MAKE ctx THE CURRENT CONTEXT FOR THIS THREAD
+
+DECIMAL_CONTEXT *selectContext(DECIMAL_CONTEXT * ctx)
+{
+    DECIMAL_CONTEXT *prev = CurrentContext;
+
+    CurrentContext = ctx ? ctx : &DefaultContext;
+    return prev;
+}
+
 const int lowestzerobit[16] = {
     0,  // 0000
     1,  // 0001
@@ -601,9 +633,9 @@ void add_karatsuba(BINT * start, BINT * a, BINT * b)
     tmp1.w = lo;
     tmp2.w = mid;
     tmp3.w = hi;
-    hi32_1 = (((tmp1.w32[1] << 6) | (tmp1.w32[0] >> 26)) * 2882303762ULL) >> 32;
-    hi32_2 = (((tmp2.w32[1] << 6) | (tmp2.w32[0] >> 26)) * 2882303762ULL) >> 32;
-    hi32_3 = (((tmp3.w32[1] << 6) | (tmp3.w32[0] >> 26)) * 2882303762ULL) >> 32;
+    hi32_1 = (((tmp1.w32[1] << 6) | (tmp1.w32[0] >> 26)) * 2882303761ULL) >> 32;
+    hi32_2 = (((tmp2.w32[1] << 6) | (tmp2.w32[0] >> 26)) * 2882303761ULL) >> 32;
+    hi32_3 = (((tmp3.w32[1] << 6) | (tmp3.w32[0] >> 26)) * 2882303761ULL) >> 32;
     lo32_1 = tmp1.w + hi32_1 * 4194967296U;
     lo32_2 = tmp2.w + hi32_2 * 4194967296U;
     lo32_3 = tmp3.w + hi32_3 * 4194967296U;
@@ -2116,41 +2148,79 @@ void acc_real_int(REAL * result, BINT number, BINT exponent)
 
 }
 
-// MULTIPLY 2 REAL NUMBERS AND ACCUMULATE RESULT
-// ALL COEFFICIENTS **MUST** BE POSITIVE
+#ifdef __ENABLE_HOST64_KERNELS__
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// MULTIPLY na x nb WORDS AND ACCUMULATE ON result, FOR 64-BIT HOSTS
+// EACH RESULT WORD ADDS ALL ITS PARTIAL PRODUCTS IN A 64-BIT ACCUMULATOR
+// AND CARRIES ONCE. COEFFICIENTS ARE BELOW 10^8, SO OVER 1800 PRODUCTS FIT
+// IN THE ACCUMULATOR, MUCH MORE THAN THE LONGEST OPERAND
+// RESULT IS RETURNED CARRY-CORRECTED
+
+static void mul_long_host64(BINT * result, BINT * a, BINT na, BINT * b,
+        BINT nb)
+{
+    UBINT64 acc, carry = 0;
+    BINT k, i, first, last;
+
+    for(k = 0; k < na + nb - 1; ++k) {
+        first = (k >= na) ? k - na + 1 : 0;
+        last = (k < nb) ? k : nb - 1;
+        acc = carry + (UBINT64) result[k];
+        i = first;
+#ifdef __AVX2__
+        // 4 PRODUCTS AT ONCE, a IS LOADED BACKWARDS AND REVERSED
+        if(last - first >= 7) {
+            __m256i sum = _mm256_setzero_si256(), va, vb;
+            UBINT64 lanes[4];
+
+            for(; i + 3 <= last; i += 4) {
+                vb = _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i *) (b +
+                                i)));
+                va = _mm256_cvtepu32_epi64(_mm_loadu_si128((__m128i *) (a +
+                                k - i - 3)));
+                va = _mm256_permute4x64_epi64(va, 0x1b);
+                sum = _mm256_add_epi64(sum, _mm256_mul_epu32(va, vb));
+            }
+            _mm256_storeu_si256((__m256i *) lanes, sum);
+            acc += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        }
+#endif
+        for(; i <= last; ++i)
+            acc += (UBINT64) b[i] * (UBINT64) a[k - i];
+        // THE COMPILER TURNS THIS INTO A 64x64->128 MULTIPLY
+        carry = acc / 100000000;
+        result[k] = (BINT) (acc - carry * 100000000);
+    }
+    result[na + nb - 1] += (BINT) carry;
+}
+#endif
+
+// MULTIPLY na x nb WORDS AND ACCUMULATE ON result
+// ALL COEFFICIENTS **MUST** BE POSITIVE, na>=nb
 // USES NAIVE METHOD WITH THE KARATSUBA TRICK TO GET A 25% SPEEDUP
+// NO FINAL CARRY CORRECTION
+// THE HIGH WORDS USE 2^58/10^8 ROUNDED DOWN, SO THEY ARE NEVER OVERESTIMATED
+// AND THE LOW WORDS NEVER GO NEGATIVE (carry_correct_pos CAN'T HANDLE THAT)
 
-void mul_real(REAL * r, REAL * a, REAL * b)
+static void mul_long_naive(BINT * result, BINT * a, BINT na, BINT * b,
+        BINT nb)
 {
-    REAL c, *result = r;
+#if !defined(__ENABLE_ARM_ASSEMBLY__) && !defined(__ENABLE_HOST64_KERNELS__)
     BINT64 hi, lo, mid;
     UWORDUNION tmp1, tmp2, tmp3;
     BINT lo32_1, hi32_1, lo32_2, hi32_2, lo32_3, hi32_3;
+#endif
 
-    if((result->data == a->data) || (result->data == b->data)) {
-        // STORE RESULT INTO ALTERNATIVE LOCATION TO PREVENT OVERWRITE
-        result = &c;
-        result->data = allocRegister();
-    }
-
-    result->flags =
-            F_NOTNORMALIZED | ((a->flags ^ b->flags) & F_NEGATIVE) | ((a->
-                flags | b->flags) & F_APPROX);
-    result->exp = a->exp + b->exp;
-    result->len = a->len + b->len;
-
-    zero_words(result->data, result->len);
+#ifdef __ENABLE_ARM_ASSEMBLY__
 
-    // MAKE SURE b IS THE SHORTEST NUMBER
-    if(a->len < b->len) {
-        REAL *tmp = a;
-        a = b;
-        b = tmp;
-    }
+    mul_real_arm(result, a, b, (na << 16) | nb);
 
-#ifdef __ENABLE_ARM_ASSEMBLY__
+#elif defined(__ENABLE_HOST64_KERNELS__)
 
-    mul_real_arm(result->data, a->data, b->data, (a->len << 16) | (b->len));
+    mul_long_host64(result, a, na, b, nb);
 
 #else
 
@@ -2159,17 +2229,17 @@ void mul_real(REAL * r, REAL * a, REAL * b)
     i = 0;
 
     // DOUBLE WORD, KARATSUBA 3-MULT LOOP
-    while(i < b->len - 1) {
+    while(i < nb - 1) {
         j = 0;
-        while(j < a->len - 1) {
+        while(j < na - 1) {
 
-            //add_karatsuba(result->data+i+j,a->data+j,b->data+i);
+            //add_karatsuba(result+i+j,a+j,b+i);
             // INLINED add_karatsuba
 
-            lo = a->data[j] * (BINT64) b->data[i];
-            hi = a->data[j + 1] * (BINT64) b->data[i + 1];
-            mid = (a->data[j + 1] + a->data[j]) * (BINT64) (b->data[i] +
-                    b->data[i + 1]) - hi - lo;
+            lo = a[j] * (BINT64) b[i];
+            hi = a[j + 1] * (BINT64) b[i + 1];
+            mid = (a[j + 1] + a[j]) * (BINT64) (b[i] +
+                    b[i + 1]) - hi - lo;
 
             // UNROLLED add_single64()
             // NUMBER IS GUARANTEED TO BE POSITIVE
@@ -2177,69 +2247,234 @@ void mul_real(REAL * r, REAL * a, REAL * b)
             tmp2.w = mid;
             tmp3.w = hi;
             hi32_1 = (((tmp1.w32[1] << 6) | (tmp1.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             hi32_2 = (((tmp2.w32[1] << 6) | (tmp2.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             hi32_3 = (((tmp3.w32[1] << 6) | (tmp3.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             lo32_1 = tmp1.w + hi32_1 * 4194967296U;
             lo32_2 = tmp2.w + hi32_2 * 4194967296U;
             lo32_3 = tmp3.w + hi32_3 * 4194967296U;
-            result->data[i + j] += lo32_1;
-            result->data[i + j + 1] += lo32_2 + hi32_1;
-            result->data[i + j + 2] += lo32_3 + hi32_2;
-            result->data[i + j + 3] += hi32_3;
+            result[i + j] += lo32_1;
+            result[i + j + 1] += lo32_2 + hi32_1;
+            result[i + j + 2] += lo32_3 + hi32_2;
+            result[i + j + 3] += hi32_3;
 
             j += 2;
         }
-        if(j < a->len) {
-            //add_single64(result->data+i+j,a->data[j]*(UBINT64)b->data[i]);
-            //add_single64(result->data+i+1+j,a->data[j]*(UBINT64)b->data[i+1]);
+        if(j < na) {
+            //add_single64(result+i+j,a[j]*(UBINT64)b[i]);
+            //add_single64(result+i+1+j,a[j]*(UBINT64)b[i+1]);
 
             // UNROLLED add_single64()
             // NUMBER IS GUARANTEED TO BE POSITIVE
-            tmp1.w = a->data[j] * (UBINT64) b->data[i];
-            tmp2.w = a->data[j] * (UBINT64) b->data[i + 1];
+            tmp1.w = a[j] * (UBINT64) b[i];
+            tmp2.w = a[j] * (UBINT64) b[i + 1];
             hi32_1 = (((tmp1.w32[1] << 6) | (tmp1.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             hi32_2 = (((tmp2.w32[1] << 6) | (tmp2.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             lo32_1 = tmp1.w + hi32_1 * 4194967296U;
             lo32_2 = tmp2.w + hi32_2 * 4194967296U;
-            result->data[i + j] += lo32_1;
-            result->data[i + j + 1] += lo32_2 + hi32_1;
-            result->data[i + j + 2] += hi32_2;
+            result[i + j] += lo32_1;
+            result[i + j + 1] += lo32_2 + hi32_1;
+            result[i + j + 2] += hi32_2;
 
         }
 
         if((i != 0) && !(i & 7))
-            carry_correct_pos(result->data + i - 8, a->len + 9);
+            carry_correct_pos(result + i - 8, na + 9);
         i += 2;
     }
 
     // SINGLE WORD LOOP
-    while(i < b->len) {
+    while(i < nb) {
         j = 0;
-        while(j < a->len) {
-            //add_single64(result->data+i+j,a->data[j]*(UBINT64)b->data[i]);
+        while(j < na) {
+            //add_single64(result+i+j,a[j]*(UBINT64)b[i]);
 
             // UNROLLED add_single64()
             // NUMBER IS GUARANTEED TO BE POSITIVE
-            tmp1.w = a->data[j] * (UBINT64) b->data[i];
+            tmp1.w = a[j] * (UBINT64) b[i];
             hi32_1 = (((tmp1.w32[1] << 6) | (tmp1.w32[0] >> 26)) *
-                    2882303762ULL) >> 32;
+                    2882303761ULL) >> 32;
             lo32_1 = tmp1.w + hi32_1 * 4194967296U;
-            result->data[i + j] += lo32_1;
-            result->data[i + j + 1] += hi32_1;
+            result[i + j] += lo32_1;
+            result[i + j + 1] += hi32_1;
 
             ++j;
         }
         if((i != 0) && !(i & 7))
-            carry_correct_pos(result->data + i - 8, a->len + 9);
+            carry_correct_pos(result + i - 8, na + 9);
         ++i;
     }
 
 #endif
+}
+
+
+// MULTIPLY n x n WORDS USING RECURSIVE KARATSUBA
+// result HAS 2*n WORDS, IT'S OVERWRITTEN AND RETURNED CARRY-CORRECTED
+// scratch NEEDS 2*((n+1)/2) WORDS PER LEVEL OF RECURSION
+// SUBTRACTIVE FORM: a0*b1+a1*b0 = a0*b0 + a1*b1 - (a0-a1)*(b0-b1)
+
+static void mul_long_kara(BINT * result, BINT * a, BINT * b, BINT n,
+        BINT * scratch)
+{
+    BINT h, l, i, sign;
+
+    if(n < KARATSUBA_MINWORDS) {
+        zero_words(result, 2 * n);
+        mul_long_naive(result, a, n, b, n);
+        carry_correct_pos(result, 2 * n);
+        return;
+    }
+
+    h = n >> 1; // WORDS IN THE LOW HALF
+    l = n - h;  // WORDS IN THE HIGH HALF, l>=h
+
+    // DIFFERENCES GO IN THE RESULT AREA, NOT NEEDED UNTIL THE END
+    // (a0-a1) IN result[0..l-1], (b0-b1) IN result[l..2l-1]
+    for(i = 0; i < h; ++i) {
+        result[i] = a[i] - a[h + i];
+        result[l + i] = b[i] - b[h + i];
+    }
+    if(l > h) {
+        result[h] = -a[n - 1];
+        result[l + h] = -b[n - 1];
+    }
+    carry_correct(result, l);
+    carry_correct(result + l, l);
+
+    sign = 0;
+    if(result[l - 1] < 0) {
+        for(i = 0; i < l; ++i)
+            result[i] = -result[i];
+        carry_correct(result, l);
+        sign ^= 1;
+    }
+    if(result[2 * l - 1] < 0) {
+        for(i = 0; i < l; ++i)
+            result[l + i] = -result[l + i];
+        carry_correct(result + l, l);
+        sign ^= 1;
+    }
+
+    // MIDDLE PRODUCT |a0-a1|*|b0-b1| IN scratch[0..2l-1]
+    mul_long_kara(scratch, result, result + l, l, scratch + 2 * l);
+
+    // LOW AND HIGH PRODUCTS OVERWRITE THE DIFFERENCES
+    mul_long_kara(result, a, b, h, scratch + 2 * l);
+    mul_long_kara(result + 2 * h, a + h, b + h, l, scratch + 2 * l);
+
+    // MIDDLE TERM = LOW + HIGH -/+ MIDDLE PRODUCT
+    if(sign) {
+        for(i = 0; i < 2 * l; ++i)
+            scratch[i] += result[2 * h + i];
+    }
+    else {
+        for(i = 0; i < 2 * l; ++i)
+            scratch[i] = result[2 * h + i] - scratch[i];
+    }
+    for(i = 0; i < 2 * h; ++i)
+        scratch[i] += result[i];
+
+    // ADD IT IN THE MIDDLE POSITION
+    for(i = 0; i < 2 * l; ++i)
+        result[h + i] += scratch[i];
+
+    carry_correct(result + h, 2 * n - h);
+}
+
+// NUMBER OF SCRATCH WORDS NEEDED BY mul_long_kara() FOR n x n WORDS
+
+static BINT kara_scratch(BINT n)
+{
+    BINT words = 0;
+    while(n >= KARATSUBA_MINWORDS) {
+        n -= n >> 1;
+        words += 2 * n;
+    }
+    return words;
+}
+
+// MULTIPLY na x nb WORDS, result MUST BE ZEROED, na>=nb
+// USES KARATSUBA IN BLOCKS OF nb WORDS WHEN THE OPERANDS ARE LARGE ENOUGH
+
+static void mul_long(BINT * result, BINT * a, BINT na, BINT * b, BINT nb)
+{
+    BINT *scratch;
+    BINT offset, i;
+
+    offset = kara_scratch(nb);
+    if(na >= 2 * nb)
+        offset += 2 * nb;
+    if((nb < KARATSUBA_MINWORDS) || (offset > REAL_REGISTER_STORAGE)) {
+        mul_long_naive(result, a, na, b, nb);
+        return;
+    }
+
+    i = Context.flags;
+    scratch = allocRegister();
+    if(!scratch) {
+        // NO TEMPORARY STORAGE, USE THE SLOW METHOD
+        Context.flags = i;
+        mul_long_naive(result, a, na, b, nb);
+        return;
+    }
+
+    // FIRST BLOCK GOES DIRECTLY ON THE RESULT
+    mul_long_kara(result, a, b, nb, scratch);
+
+    // ALL OTHER FULL BLOCKS OVERLAP, SO ACCUMULATE THEM
+    for(offset = nb; offset + nb <= na; offset += nb) {
+        mul_long_kara(scratch, a + offset, b, nb, scratch + 2 * nb);
+        for(i = 0; i < 2 * nb; ++i)
+            result[offset + i] += scratch[i];
+        carry_correct_pos(result + offset, na + nb - offset);
+    }
+
+    // LEFTOVER WORDS, SHORTER THAN nb
+    if(offset < na) {
+        zero_words(scratch, na - offset + nb);
+        mul_long_naive(scratch, b, nb, a + offset, na - offset);
+        for(i = 0; i < na - offset + nb; ++i)
+            result[offset + i] += scratch[i];
+        carry_correct_pos(result + offset, na + nb - offset);
+    }
+
+    freeRegister(scratch);
+}
+
+// MULTIPLY 2 REAL NUMBERS
+// ALL COEFFICIENTS **MUST** BE POSITIVE
+
+void mul_real(REAL * r, REAL * a, REAL * b)
+{
+    REAL c, *result = r;
+
+    if((result->data == a->data) || (result->data == b->data)) {
+        // STORE RESULT INTO ALTERNATIVE LOCATION TO PREVENT OVERWRITE
+        result = &c;
+        result->data = allocRegister();
+    }
+
+    result->flags =
+            F_NOTNORMALIZED | ((a->flags ^ b->flags) & F_NEGATIVE) | ((a->
+                flags | b->flags) & F_APPROX);
+    result->exp = a->exp + b->exp;
+    result->len = a->len + b->len;
+
+    zero_words(result->data, result->len);
+
+    // MAKE SURE b IS THE SHORTEST NUMBER
+    if(a->len < b->len) {
+        REAL *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    mul_long(result->data, a->data, a->len, b->data, b->len);
 
     // DONE - NO CARRY CORRECTION OR NORMALIZATION HERE
 
@@ -2442,6 +2677,164 @@ const int const pow10_8[8] = {
     10000000
 };
 
+// FINAL STEP OF THE TEXT CONVERSION: CHECK EXPONENT RANGE, REPLACE WITH
+// INFINITY OR APPROXIMATED ZERO AS NEEDED AND NORMALIZE
+
+static void text_real_finish(REAL * result)
+{
+    if(result->exp > MAX_EXPONENT) {
+        // CHANGE TO +/- INFINITY
+        result->flags |= F_INFINITY | F_OVERFLOW;
+        result->data[0] = 0;
+        result->len = 1;
+        result->exp = 0;
+        return;
+    }
+
+    if(result->exp < MIN_EXPONENT) {
+        // CHANGE TO APPROX. ZERO
+        result->flags =
+                F_APPROX | ((result->
+                    flags & F_NEGATIVE) ? (F_NEGATIVE | F_NEGUNDERFLOW) :
+                F_POSUNDERFLOW);
+        result->data[0] = 0;
+        result->len = 1;
+        result->exp = 0;
+        return;
+    }
+
+// NUMBER MAY HAVE CARRY PROBLEMS ONLY IF > 2*REAL_PRECISION_MAX DIGITS WERE IN THE STRING
+// REDUCE len IF MSW ARE ZERO
+
+    normalize(result);
+}
+
+// CONVERT 8 ASCII DIGITS TO A WORD IN ONE GO (SWAR)
+// THE BYTES ARE PACKED LITTLE-ENDIAN REGARDLESS OF THE TARGET, SO THE FIRST
+// (MOST SIGNIFICANT) DIGIT IS IN THE LOWEST BYTE
+// RETURNS -1 IF ANY OF THE 8 CHARACTERS IS NOT A DIGIT
+
+static BINT chunk2word(const char *text)
+{
+    const unsigned char *ptr = (const unsigned char *)text;
+    UBINT64 chunk = (UBINT64) ptr[0] | ((UBINT64) ptr[1] << 8) |
+            ((UBINT64) ptr[2] << 16) | ((UBINT64) ptr[3] << 24) |
+            ((UBINT64) ptr[4] << 32) | ((UBINT64) ptr[5] << 40) |
+            ((UBINT64) ptr[6] << 48) | ((UBINT64) ptr[7] << 56);
+
+    // ALL BYTES MUST BE 0x30..0x39
+    if(((chunk & 0xf0f0f0f0f0f0f0f0ULL) | (((chunk +
+                                0x0606060606060606ULL) &
+                            0xf0f0f0f0f0f0f0f0ULL) >> 4)) !=
+            0x3333333333333333ULL)
+        return -1;
+
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10 + (chunk >> 8)) & 0x00ff00ff00ff00ffULL;
+    chunk = (chunk * 100 + (chunk >> 16)) & 0x0000ffff0000ffffULL;
+    chunk = (chunk * 10000 + (chunk >> 32)) & 0xffffffffULL;
+
+    return (BINT) chunk;
+}
+
+// FAST PATH FOR PLAIN NUMBERS: [DIGITS][DOT DIGITS][E[+-]DIGITS]
+// THE SIGN AND FINAL DOT WERE ALREADY REMOVED BY THE CALLER
+// SCANS FORWARD ONCE, THEN PACKS THE MANTISSA 8 DIGITS AT A TIME
+// RETURNS 0 WITHOUT TOUCHING THE MANTISSA IF THE TEXT HAS ANYTHING ELSE
+// (SEPARATORS, UTF8 CHARACTERS, MALFORMED EXPONENTS), SO THE GENERAL
+// PARSER CAN HANDLE IT AND REPORT ERRORS
+
+static BINT text_real_fast(REAL * result, char *text, char *end,
+        UBINT64 chars)
+{
+    char *ptr = text, *intend, *fracstart, *fracend;
+    int nint, ndigits, expval = 0, expneg = 0, expdigits = 0;
+    WORD dot = DECIMAL_DOT(chars);
+
+    while((ptr < end) && (*ptr >= '0') && (*ptr <= '9'))
+        ++ptr;
+    intend = fracstart = fracend = ptr;
+
+    if((ptr < end) && (dot < 0x80) && (*ptr == (char)dot)) {
+        fracstart = ++ptr;
+        while((ptr < end) && (*ptr >= '0') && (*ptr <= '9'))
+            ++ptr;
+        fracend = ptr;
+        // A DOT WITH NO FRACTIONAL DIGITS IS LEFT TO THE GENERAL PARSER
+        if(fracend == fracstart)
+            return 0;
+    }
+
+    if((ptr < end) && ((*ptr == 'e') || (*ptr == 'E'))) {
+        ++ptr;
+        if((ptr < end) && ((*ptr == '+') || (*ptr == '-'))) {
+            expneg = (*ptr == '-');
+            ++ptr;
+        }
+        while((ptr < end) && (*ptr >= '0') && (*ptr <= '9')) {
+            expval = expval * 10 + (*ptr - '0');
+            ++expdigits;
+            ++ptr;
+        }
+        if(!expdigits || (expdigits > 6))
+            return 0;
+    }
+
+    if(ptr != end)
+        return 0;
+
+    nint = intend - text;
+    ndigits = nint + (fracend - fracstart);
+    if(!ndigits || (ndigits > (REAL_REGISTER_STORAGE - 1) * 8))
+        return 0;
+
+    if(ndigits <= 8) {
+        // ONE-LIMB SHORTCUT
+        BINT word = 0;
+        for(ptr = text; ptr < intend; ++ptr)
+            word = word * 10 + (*ptr - '0');
+        for(ptr = fracstart; ptr < fracend; ++ptr)
+            word = word * 10 + (*ptr - '0');
+        result->data[0] = word;
+        result->len = 1;
+    }
+    else {
+        // PACK FROM THE LEAST SIGNIFICANT DIGIT, DIGIT k IS AT
+        // text[k] IN THE INTEGER PART, fracstart[k-nint] IN THE FRACTION
+        int last = ndigits, first, k, w = 0;
+        BINT word;
+
+        while(last > 0) {
+            first = last - 8;
+            if(first < 0)
+                first = 0;
+            word = -1;
+            if(last - first == 8) {
+                if(last <= nint)
+                    word = chunk2word(text + first);
+                else if(first >= nint)
+                    word = chunk2word(fracstart + first - nint);
+            }
+            if(word < 0) {
+                // PARTIAL WORD OR STRADDLING THE DOT
+                word = 0;
+                for(k = first; k < last; ++k)
+                    word = word * 10 + ((k <
+                                nint) ? text[k] : fracstart[k - nint]) - '0';
+            }
+            result->data[w++] = word;
+            last = first;
+        }
+        result->len = w;
+    }
+
+    result->exp = (expneg ? -expval : expval) - (fracend - fracstart);
+
+    text_real_finish(result);
+
+    return 1;
+}
+
 void newRealFromText(REAL * result, char *text, char *end, UBINT64 chars)
 {
     int digits = 0;
@@ -2530,6 +2923,10 @@ void newRealFromText(REAL * result, char *text, char *end, UBINT64 chars)
 
     }
 
+    // PLAIN NUMBERS DON'T NEED THE CHARACTER BY CHARACTER PARSER
+    if(text_real_fast(result, text, end, chars))
+        return;
+
     // GET DIGITS
     while(end > text) {
         end = utf8rskip(end, text);
@@ -2709,35 +3106,7 @@ void newRealFromText(REAL * result, char *text, char *end, UBINT64 chars)
     result->len = (digits + 7) >> 3;
     result->exp += exp;
 
-// TODO: DO SOME CLEANUP...
-
-// CHECK EXPONENT RANGE, REPLACE WITH INFINITY AS NEEDED
-
-    if(result->exp > MAX_EXPONENT) {
-        // CHANGE TO +/- INFINITY
-        result->flags |= F_INFINITY | F_OVERFLOW;
-        result->data[0] = 0;
-        result->len = 1;
-        result->exp = 0;
-        return;
-    }
-
-    if(result->exp < MIN_EXPONENT) {
-        // CHANGE TO APPROX. ZERO
-        result->flags =
-                F_APPROX | ((result->
-                    flags & F_NEGATIVE) ? (F_NEGATIVE | F_NEGUNDERFLOW) :
-                F_POSUNDERFLOW);
-        result->data[0] = 0;
-        result->len = 1;
-        result->exp = 0;
-        return;
-    }
-
-// NUMBER MAY HAVE CARRY PROBLEMS ONLY IF > 2*REAL_PRECISION_MAX DIGITS WERE IN THE STRING
-// REDUCE len IF MSW ARE ZERO
-
-    normalize(result);
+    text_real_finish(result);
 
 // ONLY THING NOT DONE HERE IS TRUNCATION TO CURRENT SYSTEM PRECISION, BUT SINCE THIS NUMBER IS
 // CONVERTED FROM A STRING, IT'S BETTER TO LEAVE IT AS-IS.
@@ -2800,17 +3169,32 @@ void newRealFromText(REAL * result, char *text, char *end, UBINT64 chars)
 
 // ALL FOUR CHARACTERS ARE PACKED IN A 32-BIT WORD
 
+// ALL PAIRS OF DIGITS 00 TO 99, TO CONVERT 2 DIGITS PER LOOKUP
+static const char digitpairs[200] =
+        "00010203040506070809" "10111213141516171819"
+        "20212223242526272829" "30313233343536373839"
+        "40414243444546474849" "50515253545556575859"
+        "60616263646566676869" "70717273747576777879"
+        "80818283848586878889" "90919293949596979899";
+
 void word2digits(BINT word, char *digits)
 {
-    int f;
-
-    for(f = 7; f >= 0; --f, ++digits) {
-        *digits = '0';
-        while(word >= pow10_8[f]) {
-            ++digits[0];
-            word -= pow10_8[f];
-        }
-    }
+    BINT hi = word / 10000, lo = word - hi * 10000;
+    BINT hh = hi / 100, lh = lo / 100;
+    const char *pair;
+
+    pair = digitpairs + 2 * hh;
+    digits[0] = pair[0];
+    digits[1] = pair[1];
+    pair = digitpairs + 2 * (hi - hh * 100);
+    digits[2] = pair[0];
+    digits[3] = pair[1];
+    pair = digitpairs + 2 * lh;
+    digits[4] = pair[0];
+    digits[5] = pair[1];
+    pair = digitpairs + 2 * (lo - lh * 100);
+    digits[6] = pair[0];
+    digits[7] = pair[1];
 }
 
 // ADD ROUND THE LAST DIGIT OF A STRING
@@ -3240,7 +3624,7 @@ char *formatReal(REAL * number, char *buffer, BINT format, UBINT64 chars)
 
     int j = number->len - 1;
     int digitcount = 0;
-    int i = 0;
+    int i = 0, run;
 
     //   INTEGER PART
     while(digitcount < integer) {
@@ -3284,10 +3668,22 @@ char *formatReal(REAL * number, char *buffer, BINT format, UBINT64 chars)
             }
         }
 
-        buffer[idx++] = worddigits[i];
-        ++countdigits;
-        ++digitcount;
-        ++i;
+        // WITHOUT SEPARATORS, COPY THE REST OF THE WORD AT ONCE, STOPPING
+        // AT THE DECIMAL DOT AND AT THE ROUNDING DIGIT
+        run = 1;
+        if((format & FMT_CODE) || !(format & FMT_NUMSEPARATOR)) {
+            run = 8 - i;
+            if(run > integer - digitcount)
+                run = integer - digitcount;
+            if(run > totalcount - countdigits)
+                run = totalcount - countdigits;
+            if((idx < dotpos) && (run > dotpos - idx))
+                run = dotpos - idx;
+        }
+        countdigits += run;
+        digitcount += run;
+        while(run--)
+            buffer[idx++] = worddigits[i++];
         i &= 7;
     }
 
@@ -3336,10 +3732,22 @@ char *formatReal(REAL * number, char *buffer, BINT format, UBINT64 chars)
             }
         }
 
-        buffer[idx++] = worddigits[i];
-        ++countdigits;
-        ++digitcount;
-        ++i;
+        // WITHOUT SEPARATORS, COPY THE REST OF THE WORD AT ONCE, STOPPING
+        // AT THE DECIMAL DOT AND AT THE ROUNDING DIGIT
+        run = 1;
+        if((format & FMT_CODE) || !(format & FMT_FRACSEPARATOR)) {
+            run = 8 - i;
+            if(run > frac - digitcount)
+                run = frac - digitcount;
+            if(run > totalcount - countdigits)
+                run = totalcount - countdigits;
+            if((idx < dotpos) && (run > dotpos - idx))
+                run = dotpos - idx;
+        }
+        countdigits += run;
+        digitcount += run;
+        while(run--)
+            buffer[idx++] = worddigits[i++];
         i &= 7;
     }
 
@@ -3752,62 +4160,214 @@ void div_real(REAL * r, REAL * num, REAL * d, int maxdigits)
 
 }
 
-// DIVIDE A NUMBER USING NEWTON-RAPHSON INVERSION
+// READ-ONLY VIEW OF THE MOST SIGNIFICANT words OF x, WITHOUT SIGN
 
-void div_real_nr(REAL * result, REAL * num, REAL * div)
+static void view_words(REAL * view, REAL * x, BINT words)
 {
+    view->data = x->data;
+    view->exp = x->exp;
+    view->flags = x->flags & ~F_NEGATIVE;
+    view->len = x->len;
+
+    if(words < x->len) {
+        view->data += x->len - words;
+        view->exp += (x->len - words) << 3;
+        view->len = words;
+    }
+}
 
-    REAL xi;
+// COMPUTE x=1/d WITH AT LEAST digits CORRECT FIGURES USING NEWTON-RAPHSON
+// X(i+1)=Xi + Xi*(1-D*Xi), EACH STEP DOUBLES THE NUMBER OF CORRECT DIGITS
+// SO ONLY THE LAST STEP RUNS AT FULL PRECISION
+// d MUST BE NORMALIZED, ITS SIGN IS IGNORED
+// t AND e ARE TEMPORARY STORAGE
 
-    // FIRST ROUGH APPROXIMATION
-    xi.data = allocRegister();  // WARNING, NO CHECK FOR OUT OF MEMORY
-    //xi.data[0]=1;
-    //xi.len=1;
-    //xi.flags=0;
-    //xi.exp=-(sig_digits(div->data[div->len-1])+((div->len-1)<<3)+div->exp);   // ESTIMATE OF THE INVERSE BY THE EXPONENT
+static void recip_real_nr(REAL * x, REAL * d, BINT digits, REAL * t,
+        REAL * e)
+{
+    REAL one, dv, xv;
+    BINT onedata = 1;
+    BINT good, target, saveprec = Context.precdigits;
 
-    REAL one;
-    one.data = allocRegister();
-    one.data[0] = 1;
+    one.data = &onedata;
     one.len = 1;
-    one.flags = 0;
     one.exp = 0;
+    one.flags = 0;
 
-    div_real(&xi, &one, div, 32);       // ROUGH INITIAL APPROXIMATION  TO 32 DIGITS
-
-    REAL tmp[2];
-    tmp[0].data = allocRegister();
-    tmp[1].data = allocRegister();
-
-    // X(i+1)=Xi + Xi*(1-D*Xi)
-    do {
-        mul_real2(&tmp[0], div, &xi);   // D*Xi
-        normalize(&tmp[0]);
-        round_real(&tmp[0], Context.precdigits + 8, 0);
-        sub_real(&tmp[1], &one, &tmp[0]);       // 1-D*Xi
-        normalize(&tmp[1]);
-        round_real(&tmp[1], Context.precdigits + 8, 0);
-        mul_real2(&tmp[0], &xi, &tmp[1]);       // Xi*(1-D*Xi)
-        normalize(&tmp[0]);
-        round_real(&tmp[0], Context.precdigits + 8, 0);
-        add_real(&tmp[1], &xi, &tmp[0]);        // Xi + Xi*(1-D*Xi)
-        normalize(&tmp[1]);
-        round_real(&tmp[1], Context.precdigits + 8, 0);
-        sub_real(&tmp[0], &xi, &tmp[1]);
-        normalize(&tmp[0]);
-        round_real(&tmp[0], Context.precdigits, 0);
-        copyReal(&xi, &tmp[1]);
-
-    }
-    while((tmp[0].len > 1) || (tmp[0].data[0] > 10000));        // END ONCE WE OBTAIN LESS THAN 4 DIGITS DIFFERENCE
-
-    mul_real(result, num, &xi);
-    finalize(result);
+    // INITIAL APPROXIMATION BY LONG DIVISION, ONLY THE FIRST WORDS OF THE DIVISOR MATTER
+    good = 32;
+    view_words(&dv, d, 7);
+    div_real(x, &one, &dv, good);
+    normalize(x);
+
+    while(good < digits) {
+        target = 2 * good - 4;  // LEAVE SOME MARGIN FOR THE ERROR TERM
+        if(target > digits)
+            target = digits;
+
+        // ADDITIONS MUST KEEP ALL DIGITS DOWN TO 10^-target
+        Context.precdigits = target + 16;
+
+        // e=1-D*Xi, EXACT USING A DIVISOR TRUNCATED TO THE TARGET PRECISION
+        view_words(&dv, d, ((target + 7) >> 3) + 3);
+        mul_real(t, &dv, x);
+        normalize(t);
+        sub_real(e, &one, t);
+        normalize(e);
+
+        // e IS ABOUT 10^-good, ONLY ITS FIRST target-good FIGURES MATTER
+        round_real(e, target - good + 16, 0);
+        view_words(&xv, x, ((target - good + 7) >> 3) + 3);
+        mul_real(t, &xv, e);
+        normalize(t);
+        add_real(x, x, t);
+        normalize(x);
+        round_real(x, target + 16, 0);
+
+        good = target;
+    }
+
+    x->flags = 0;
+    Context.precdigits = saveprec;
+}
+
+// DIVIDES 2 REALS USING NEWTON-RAPHSON INVERSION
+// SAME RESULT AS div_real(): AT LEAST MAXDIGITS SIGNIFICANT FIGURES, TRUNCATED
+// WITH F_APPROX SET IF THE DIVISION IS NOT EXACT
+// THE QUOTIENT FROM THE RECIPROCAL IS CORRECTED WITH THE EXACT REMAINDER
+
+void div_real_nr(REAL * r, REAL * num, REAL * d, int maxdigits)
+{
+    REAL c, *result = r;
+    REAL x, xc, *xr, t, e, dm, na, da, ulp;
+    BINT onedata = 1;
+    BINT digits, k, saveprec;
+    WORD bmp;
+
+    // NEED 3 REGISTERS, ONE MORE FOR THE RESULT AND 2 FOR THE LOWER LEVEL ROUTINES
+    k = 0;
+    for(bmp = ~Context.alloc_bmp; bmp; bmp &= bmp - 1)
+        ++k;
+    if(k < 6) {
+        // NOT ENOUGH TEMPORARY STORAGE, USE LONG DIVISION
+        div_real(r, num, d, maxdigits);
+        return;
+    }
 
-    freeRegister(xi.data);
-    freeRegister(tmp[0].data);
-    freeRegister(tmp[1].data);
-    freeRegister(one.data);
+    x.data = allocRegister();
+    t.data = allocRegister();
+    e.data = allocRegister();
+
+    if((result->data == num->data) || (result->data == d->data)) {
+        // STORE RESULT INTO ALTERNATIVE LOCATION TO PREVENT OVERWRITE
+        result = &c;
+        result->data = allocRegister();
+    }
+
+    digits = maxdigits + 16;    // DO EXTRA 16 DIGITS FOR PROPER ROUNDING, SAME AS div_real()
+
+    // RECIPROCAL OF THE DIVISOR MANTISSA
+    // THE CONTEXT KEEPS THE LAST ONE, SO LOOPS THAT DIVIDE REPEATEDLY BY THE
+    // SAME NUMBER (MODULAR ARITHMETIC, BACK-SUBSTITUTION) SKIP THE INVERSION
+    dm.data = d->data;
+    dm.len = d->len;
+    dm.exp = 0;
+    dm.flags = 0;
+
+    if((Context.recipdivlen == d->len)
+            && (Context.recipdigits >= digits + 8)) {
+        for(k = 0; k < d->len; ++k)
+            if(Context.recipdivisor[k] != d->data[k])
+                break;
+    }
+    else
+        k = -1;
+
+    if(k == d->len) {
+        xc.data = Context.recipdata;
+        xc.len = Context.reciplen;
+        xc.exp = Context.recipexp;
+        xc.flags = 0;
+        xr = &xc;
+    }
+    else {
+        recip_real_nr(&x, &dm, digits + 8, &t, &e);
+        xr = &x;
+
+        if((d->len <= RECIPCACHE_WORDS) && (x.len <= RECIPCACHE_WORDS)) {
+            for(k = 0; k < d->len; ++k)
+                Context.recipdivisor[k] = d->data[k];
+            for(k = 0; k < x.len; ++k)
+                Context.recipdata[k] = x.data[k];
+            Context.recipdivlen = d->len;
+            Context.reciplen = x.len;
+            Context.recipexp = x.exp;
+            Context.recipdigits = digits + 8;
+        }
+    }
+
+    // QUOTIENT FROM THE RECIPROCAL, TRUNCATED TO THE REQUESTED DIGITS
+    view_words(&na, num, num->len);
+    view_words(&da, d, d->len);
+    view_words(&dm, xr, ((digits + 7) >> 3) + 3);
+    dm.exp -= d->exp;
+
+    mul_real(result, &na, &dm);
+    normalize(result);
+    round_real(result, digits, 1);
+
+    // ONE UNIT IN THE LAST PLACE OF THE QUOTIENT
+    ulp.data = &onedata;
+    ulp.len = 1;
+    ulp.flags = 0;
+    ulp.exp =
+            sig_digits(result->data[result->len - 1]) +
+            ((result->len - 1) << 3) + result->exp - digits;
+
+    // EXACT REMAINDER num-q*d, WHICH MUST BE 0 <= REMAINDER < ulp*d
+    mul_real(&t, result, &da);
+    normalize(&t);
+
+    // THE SUBTRACTION CANCELS MOST DIGITS, KEEP THEM ALL
+    saveprec = Context.precdigits;
+    Context.precdigits = ((t.len > na.len) ? t.len : na.len) << 3;
+    sub_real(&e, &na, &t);
+    normalize(&e);
+
+    da.exp += ulp.exp;
+    while(e.flags & F_NEGATIVE) {
+        add_real(&e, &e, &da);
+        normalize(&e);
+        sub_real(result, result, &ulp);
+        normalize(result);
+    }
+    while(!ltReal(&e, &da)) {
+        sub_real(&e, &e, &da);
+        normalize(&e);
+        add_real(result, result, &ulp);
+        normalize(result);
+    }
+
+    Context.precdigits = saveprec;
+
+    result->flags =
+            ((num->flags ^ d->flags) & F_NEGATIVE) | ((num->flags | d->
+                flags) & F_APPROX);
+    if(!iszeroReal(&e))
+        result->flags |= F_APPROX;
+
+    freeRegister(x.data);
+    freeRegister(t.data);
+    freeRegister(e.data);
+
+    if(result != r) {
+        // COPY THE RESULT TO THE ORIGINALLY REQUESTED LOCATION
+        freeRegister(r->data);
+        r->data = result->data;
+        r->exp = result->exp;
+        r->flags = result->flags;
+        r->len = result->len;
+    }
 }
 
 // *************************************************************************
@@ -3906,16 +4466,207 @@ void newRealFromBINT64(REAL * result, BINT64 number, BINT exp10)
     result->data[1] = 0;
     result->data[2] = 0;
     // THIS IS 2^48 IN 8-DIGIT BASE
+    // (THE HIGH BITS GO IN A BINT ARRAY, READING A BINT64 THROUGH A BINT
+    // POINTER IS NOT PORTABLE AND PRODUCED GARBAGE WITH OPTIMIZING COMPILERS)
     const BINT two_48[2] = { 76710656, 2814749 };
-    BINT64 hibits = number >> 48;
+    BINT hibits[2] = { (BINT) (number >> 48), 0 };
     number &= (1LL << 48) - 1;
     add_single64(result->data, number);
-    add_karatsuba(result->data, (BINT *) & hibits, (BINT *) two_48);
+    add_karatsuba(result->data, hibits, (BINT *) two_48);
     carry_correct(result->data, 3);
     result->len = 3;
     return;
 }
 
+// FAST PATHS FOR SHORT OPERANDS (UP TO 2 WORDS = 16 DIGITS)
+// ALL OPERATIONS ARE DONE IN 64-BIT INTEGERS AND PRODUCE EXACTLY THE SAME
+// WORDS, EXPONENT AND FLAGS THE GENERAL ROUTINES WOULD PRODUCE AFTER
+// NORMALIZATION. THEY RETURN 0 WHEN THE GENERAL PATH IS NEEDED.
+
+// EXPONENTS BEYOND THIS ARE LEFT TO THE GENERAL PATH, SO THE RESULT
+// CAN NEVER NEED checkrange()
+#define SMALLREAL_MAXEXP    (REAL_EXPONENT_MAX/4)
+
+static const UBINT64 small_pow10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+    10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+    100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+// RETURN TRUE IF THE NUMBER QUALIFIES FOR THE FAST PATH
+static inline int is_small_real(REAL * n)
+{
+    return (n->len <= 2) && !(n->flags & F_NOTNORMALIZED)
+            && (n->exp < SMALLREAL_MAXEXP) && (n->exp > -SMALLREAL_MAXEXP);
+}
+
+static inline UBINT64 small_mant(REAL * n)
+{
+    if(n->len == 2)
+        return (UBINT64) n->data[1] * 100000000ULL + n->data[0];
+    return n->data[0];
+}
+
+// STORE A 64-BIT MANTISSA AS A NORMALIZED NUMBER AND ROUND TO THE CURRENT PRECISION
+static void store_small(REAL * r, UBINT64 mant, BINT exp, WORD flags)
+{
+    BINT w[3], len = 0;
+
+    w[0] = (BINT) (mant % 100000000ULL);
+    mant /= 100000000ULL;
+    w[1] = (BINT) (mant % 100000000ULL);
+    w[2] = (BINT) (mant / 100000000ULL);
+
+    // REMOVE TRAILING ZERO WORDS
+    while((len < 2) && (w[len] == 0)) {
+        ++len;
+        exp += 8;
+    }
+    r->data[0] = w[len];
+    r->data[1] = (len < 2) ? w[len + 1] : 0;
+    r->data[2] = (len < 1) ? w[2] : 0;
+    r->len = 3 - len;
+    // REMOVE LEFT ZEROS
+    while((r->len > 1) && (r->data[r->len - 1] == 0))
+        --r->len;
+
+    if((r->len == 1) && (r->data[0] == 0)) {
+        exp = 0;
+        flags &= ~F_NEGATIVE;
+    }
+    r->exp = exp;
+    r->flags = flags;
+
+    round_real(r, Context.precdigits, 0);
+}
+
+// a+b, BOTH NONZERO
+static int add_real_small(REAL * r, REAL * a, REAL * b)
+{
+    // THE RESULT IS ALIGNED TO THE WORDS OF THE LARGEST OPERAND, SAME AS add_real()
+    BINT adig = sig_digits(a->data[a->len - 1]) + ((a->len - 1) << 3) + a->exp;
+    BINT bdig = sig_digits(b->data[b->len - 1]) + ((b->len - 1) << 3) + b->exp;
+    if((adig < bdig) || ((adig == bdig)
+                && (a->data[a->len - 1] < b->data[b->len - 1]))) {
+        REAL *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    BINT exp = a->exp;
+    if(b->exp < exp)
+        exp -= (exp - b->exp + 7) & ~7;
+
+    BINT ashift = a->exp - exp, bshift = b->exp - exp;
+    UBINT64 am = small_mant(a), bm = small_mant(b);
+
+    // BOTH ALIGNED MANTISSAS MUST BE BELOW 10^18 SO THE SUM CAN'T OVERFLOW
+    if((ashift > 18) || (bshift > 18))
+        return 0;
+    if((am >= small_pow10[18 - ashift]) || (bm >= small_pow10[18 - bshift]))
+        return 0;
+    am *= small_pow10[ashift];
+    bm *= small_pow10[bshift];
+
+    WORD flags = (a->flags | b->flags) & F_APPROX;
+    if((a->flags ^ b->flags) & F_NEGATIVE) {
+        if(am >= bm)
+            store_small(r, am - bm, exp, flags | (a->flags & F_NEGATIVE));
+        else
+            store_small(r, bm - am, exp, flags | (b->flags & F_NEGATIVE));
+    }
+    else
+        store_small(r, am + bm, exp, flags | (a->flags & F_NEGATIVE));
+    return 1;
+}
+
+// a*b
+static void mul_real_small(REAL * r, REAL * a, REAL * b)
+{
+    UBINT64 a0 = a->data[0], a1 = (a->len > 1) ? a->data[1] : 0;
+    UBINT64 b0 = b->data[0], b1 = (b->len > 1) ? b->data[1] : 0;
+    UBINT64 t;
+    BINT w[4], len = 0, exp = a->exp + b->exp;
+    WORD flags = ((a->flags ^ b->flags) & F_NEGATIVE) | ((a->
+                flags | b->flags) & F_APPROX);
+
+    t = a0 * b0;
+    w[0] = (BINT) (t % 100000000ULL);
+    t = a0 * b1 + a1 * b0 + t / 100000000ULL;
+    w[1] = (BINT) (t % 100000000ULL);
+    t = a1 * b1 + t / 100000000ULL;
+    w[2] = (BINT) (t % 100000000ULL);
+    w[3] = (BINT) (t / 100000000ULL);
+
+    // REMOVE TRAILING ZERO WORDS
+    while((len < 3) && (w[len] == 0)) {
+        ++len;
+        exp += 8;
+    }
+    r->len = 4 - len;
+    r->data[0] = w[len];
+    r->data[1] = (len < 3) ? w[len + 1] : 0;
+    r->data[2] = (len < 2) ? w[len + 2] : 0;
+    r->data[3] = (len < 1) ? w[3] : 0;
+    // REMOVE LEFT ZEROS
+    while((r->len > 1) && (r->data[r->len - 1] == 0))
+        --r->len;
+
+    if((r->len == 1) && (r->data[0] == 0)) {
+        exp = 0;
+        flags &= ~F_NEGATIVE;
+    }
+    r->exp = exp;
+    r->flags = flags;
+
+    round_real(r, Context.precdigits, 0);
+}
+
+// a/b, b NONZERO. ONLY TERMINATING QUOTIENTS ARE DONE HERE
+static int div_real_small(REAL * r, REAL * a, REAL * b)
+{
+    UBINT64 am = small_mant(a), bm = small_mant(b), m = bm;
+    BINT n2 = 0, n5 = 0;
+
+    // div_real() ONLY GUARANTEES AN EXACT 3-WORD QUOTIENT WITH 4 RESULT WORDS OR MORE
+    if(Context.precdigits <= 8)
+        return 0;
+
+    // THE QUOTIENT TERMINATES ONLY IF b HAS NO PRIME FACTORS OTHER THAN 2 AND 5
+    // AFTER CANCELLING THE COMMON FACTORS WITH a
+    while(!(m & 1)) {
+        m >>= 1;
+        ++n2;
+    }
+    while(!(m % 5)) {
+        m /= 5;
+        ++n5;
+    }
+    if((m > 1) && (am % m))
+        return 0;
+
+    BINT n = (n2 > n5) ? n2 : n5;
+
+    // div_real() ALIGNS ITS RESULT RELATIVE TO THE LEFT-JUSTIFIED DIVISOR
+    BINT grid = ((a->len - b->len) << 3) + a->exp - b->exp + 8 -
+            sig_digits(b->data[b->len - 1]);
+    BINT exp = a->exp - b->exp - n;
+    BINT shift = (exp - grid) & 7;
+
+    n += shift;
+    exp -= shift;
+    if((n > 19) || (am >= small_pow10[19 - n]))
+        return 0;
+
+    store_small(r, (am * small_pow10[n]) / bm, exp,
+            ((a->flags ^ b->flags) & F_NEGATIVE) | ((a->
+                    flags | b->flags) & F_APPROX));
+    return 1;
+}
+
 // ADDITION OF 2 REALS
 // DEALS WITH SPECIALS AND FULLY FINALIZE THE ANSWER
 
@@ -3996,8 +4747,12 @@ void addReal(REAL * result, REAL * a, REAL * b)
         copyReal(result, b);
     else if(b->len == 1 && b->data[0] == 0)
         copyReal(result, a);
-    else
+    else {
+        if(is_small_real(a) && is_small_real(b)
+                && add_real_small(result, a, b))
+            return;
         add_real(result, a, b);
+    }
     finalize(result);
 }
 
@@ -4122,6 +4877,11 @@ void mulReal(REAL * result, REAL * a, REAL * b)
         }
     }
 
+    if(is_small_real(a) && is_small_real(b)) {
+        mul_real_small(result, a, b);
+        return;
+    }
+
     mul_real(result, a, b);
     finalize(result);
 
@@ -4226,7 +4986,14 @@ void divReal(REAL * result, REAL * a, REAL * b)
         return;
     }
 
-    div_real(result, a, b, Context.precdigits);
+    if(is_small_real(a) && is_small_real(b)
+            && div_real_small(result, a, b))
+        return;
+
+    if(b->len >= NEWTON_DIV_MINWORDS)
+        div_real_nr(result, a, b, Context.precdigits);
+    else
+        div_real(result, a, b, Context.precdigits);
     finalize(result);
 
 }
@@ -4363,7 +5130,10 @@ void divmodReal(REAL * quotient, REAL * remainder, REAL * a, REAL * b)
         quot->flags = 0;
     }
     else {
-        div_real(quot, a, b, ndigits);
+        if(b->len >= NEWTON_DIV_MINWORDS)
+            div_real_nr(quot, a, b, ndigits);
+        else
+            div_real(quot, a, b, ndigits);
         quot->flags = (quot->flags & ~F_APPROX) | ((a->flags | b->flags) & F_APPROX);   // ONLY APPROX. IF EITHER ARGUMENT WAS APPROX.
         normalize(quot);
     }
@@ -4427,6 +5197,44 @@ void divmodReal(REAL * quotient, REAL * remainder, REAL * a, REAL * b)
 
 }
 
+// SAME OPERATIONS USING AN EXPLICIT CONTEXT
+
+void addRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    addReal(result, a, b);
+    selectContext(prev);
+}
+
+void subRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    subReal(result, a, b);
+    selectContext(prev);
+}
+
+void mulRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    mulReal(result, a, b);
+    selectContext(prev);
+}
+
+void divRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    divReal(result, a, b);
+    selectContext(prev);
+}
+
+void divmodRealCtx(DECIMAL_CONTEXT * ctx, REAL * quotient, REAL * remainder,
+        REAL * a, REAL * b)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    divmodReal(quotient, remainder, a, b);
+    selectContext(prev);
+}
+
 // ROUND A REAL NUMBER TO A CERTAIN NUMBER OF DIGITS AFTER DECIMAL DOT
 // IF NFIGURES IS NEGATIVE, NFIGURES = TOTAL NUMBER OF SIGNIFICANT DIGITS
 // HANDLE SPECIALS
@@ -5373,6 +6181,93 @@ BINT64 getBINT64Real(REAL * n)
         return -result;
     return result;
 }
+// BINARY POWERS OF TEN 10^(2^k) FOR CONVERSIONS TO AND FROM double
+static const double dbl_pow10[] = {
+    1e1, 1e2, 1e4, 1e8, 1e16, 1e32, 1e64, 1e128, 1e256
+};
+
+// RETURN x*10^exp10, THE CALLER MUST MAKE SURE THE RESULT IS IN RANGE
+static double scale10_double(double x, BINT exp10)
+{
+    BINT k = 0, neg = exp10 < 0;
+    if(neg)
+        exp10 = -exp10;
+    while(exp10 && (k < 9)) {
+        if(exp10 & 1) {
+            if(neg)
+                x /= dbl_pow10[k];
+            else
+                x *= dbl_pow10[k];
+        }
+        exp10 >>= 1;
+        ++k;
+    }
+    return x;
+}
+
+// CONVERT A REAL TO A BINARY double
+// ONLY THE 3 MOST SIGNIFICANT WORDS ARE USED, ENOUGH FOR THE 53-BIT MANTISSA
+// THE CALLER MUST CHECK THE EXPONENT IS WITHIN THE RANGE OF A double
+
+double getDoubleReal(REAL * n)
+{
+    BINT k = n->len - 1, exp10 = n->exp + (k << 3);
+    double result = n->data[k];
+
+    if(k > 0) {
+        result = result * 100000000.0 + n->data[k - 1];
+        exp10 -= 8;
+    }
+    if(k > 1) {
+        result = result * 100000000.0 + n->data[k - 2];
+        exp10 -= 8;
+    }
+
+    result = scale10_double(result, exp10);
+    if(n->flags & F_NEGATIVE)
+        return -result;
+    return result;
+}
+
+// CONVERT A FINITE double TO A REAL ROUNDED TO THE GIVEN NUMBER OF DIGITS
+// result MUST HAVE STORAGE ALLOCATED
+
+void newRealFromDouble(REAL * result, double number, BINT digits)
+{
+    union
+    {
+        double d;
+        UBINT64 w;
+    } bits;
+    BINT neg = number < 0.0, exp10;
+
+    if(number == 0.0) {
+        newRealFromBINT(result, 0, 0);
+        return;
+    }
+    if(neg)
+        number = -number;
+
+    // ESTIMATE THE DECIMAL EXPONENT FROM THE BINARY ONE: LOG10(2)~1233/4096
+    bits.d = number;
+    exp10 = ((((BINT) (bits.w >> 52) & 0x7ff) - 1023) * 1233) / 4096;
+
+    // GET 17 SIGNIFICANT DIGITS IN [10^16,10^17)
+    number = scale10_double(number, 16 - exp10);
+    while(number >= 1e17) {
+        number /= 10.0;
+        ++exp10;
+    }
+    while(number < 1e16) {
+        number *= 10.0;
+        --exp10;
+    }
+
+    newRealFromBINT64(result, (BINT64) (number + 0.5), exp10 - 16);
+    if(neg)
+        result->flags |= F_NEGATIVE;
+    round_real(result, digits, 0);
+}
 
 BINT isoddReal(REAL * r)
 {
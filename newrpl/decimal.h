@@ -41,6 +41,35 @@ extern "C"
 #define PROTECT_WRITE_AREA(ptr,len) { if( ((ptr)<Context.regdata) || ((((WORDPTR)ptr)+(len))>=(WORDPTR)Context.regdata+REAL_REGISTER_STORAGE*TOTAL_REGISTERS)) { printf("PANIC EXIT-BAD WRITE\n"); exit(-1); } }
 #endif
 
+// MINIMUM NUMBER OF WORDS IN THE SHORTEST OPERAND TO MULTIPLY USING KARATSUBA
+// BELOW THIS, THE NAIVE MULTIPLICATION IS FASTER
+// CAN BE OVERRIDDEN AT BUILD TIME TO TUNE EACH TARGET
+#ifndef KARATSUBA_MINWORDS
+#if defined(__ENABLE_ARM_ASSEMBLY__)
+#define KARATSUBA_MINWORDS 48
+#elif defined(__ENABLE_HOST64_KERNELS__) && defined(__AVX2__)
+// THE VECTORIZED LOOP WINS UP TO THE MAXIMUM PRECISION
+#define KARATSUBA_MINWORDS REAL_REGISTER_STORAGE
+#elif defined(__ENABLE_HOST64_KERNELS__)
+#define KARATSUBA_MINWORDS 96
+#else
+#define KARATSUBA_MINWORDS 48
+#endif
+#endif
+
+// MINIMUM NUMBER OF WORDS IN THE DIVISOR TO DIVIDE USING NEWTON-RAPHSON
+// INVERSION, BELOW THIS LONG DIVISION IS FASTER
+// RUN tools/decimal-bench TO FIND THE CROSSOVER ON EACH TARGET
+#ifndef NEWTON_DIV_MINWORDS
+#if defined(__ENABLE_ARM_ASSEMBLY__)
+#define NEWTON_DIV_MINWORDS 32
+#elif defined(__ENABLE_HOST64_KERNELS__)
+#define NEWTON_DIV_MINWORDS 16
+#else
+#define NEWTON_DIV_MINWORDS 24
+#endif
+#endif
+
 #ifdef __ENABLE_ARM_ASSEMBLY__
 extern void mul_real_arm(BINT * rdata, BINT * adata, BINT * bdata, UBINT len);
 extern BINT carry_correct_arm(BINT * start, BINT * dest, BINT * end,
@@ -74,14 +103,34 @@ typedef struct __NUMBER
     BINT storage[3];
 } NUMBER;
 
+// WORDS TO KEEP THE RECIPROCAL OF THE LAST DIVISOR
+#define RECIPCACHE_WORDS    (MAX_PRECWORDS+8)
+
 typedef struct
 {
     WORD flags;
     BINT precdigits;
     WORD alloc_bmp;
     BINT regdata[REAL_REGISTER_STORAGE * TOTAL_REGISTERS];
+    REAL rreg[REAL_REGISTERS];  // PREALLOCATED REAL REGISTERS, ACCESSED AS RReg[]
+    // RECIPROCAL OF THE LAST DIVISOR INVERTED BY NEWTON-RAPHSON
+    BINT recipdivisor[RECIPCACHE_WORDS];        // MANTISSA OF THE DIVISOR
+    BINT recipdata[RECIPCACHE_WORDS];   // MANTISSA OF THE RECIPROCAL
+    BINT recipdivlen;   // WORDS IN THE DIVISOR, 0 IF THE CACHE IS EMPTY
+    BINT reciplen;      // WORDS IN THE RECIPROCAL
+    BINT recipexp;      // EXPONENT OF THE RECIPROCAL
+    BINT recipdigits;   // CORRECT DIGITS IN THE RECIPROCAL
 } DECIMAL_CONTEXT;
 
+// ALL OPERATIONS USE THE CURRENT CONTEXT, Context AND RReg REFER TO IT
+// ON THE PC EACH THREAD SELECTS ITS OWN, THE DEFAULT CONTEXT IS USED
+// UNTIL A THREAD SELECTS A DIFFERENT ONE
+#if defined(TARGET_PC) && defined(__GNUC__)
+#define DECIMAL_THREADLOCAL __thread
+#else
+#define DECIMAL_THREADLOCAL
+#endif
+
 enum ContextFlags
 {
     CTX_OUTOFMEMORY = 1,
@@ -124,6 +173,13 @@ enum RealErrors
 
 void initContext(WORD precision);
 
+// PREPARE A NEW CONTEXT WITH ITS OWN REGISTERS, READY TO BE SELECTED
+void initDecimalContext(DECIMAL_CONTEXT * ctx, WORD precision);
+
+// MAKE ctx THE CURRENT CONTEXT FOR THIS THREAD, NULL SELECTS THE DEFAULT
+// RETURNS THE PREVIOUS CONTEXT TO RESTORE IT LATER
+DECIMAL_CONTEXT *selectContext(DECIMAL_CONTEXT * ctx);
+
 BINT *allocRegister();
 void freeRegister(BINT * data);
 
@@ -229,8 +285,9 @@ void mul_real2(REAL * r, REAL * a, REAL * b);
 void div_real(REAL * r, REAL * num, REAL * d, int maxdigits);
 
 // DIVIDE A NUMBER USING NEWTON-RAPHSON INVERSION
+// SAME RESULT AS div_real(), FASTER FOR LONG DIVISORS
 
-void div_real_nr(REAL * result, REAL * num, REAL * div);
+void div_real_nr(REAL * r, REAL * num, REAL * d, int maxdigits);
 
 // *************************************************************************
 // ************* HIGH LEVEL API FOR DECIMAL LIBRARY ************************
@@ -296,6 +353,16 @@ void divReal(REAL * result, REAL * a, REAL * b);
 
 void divmodReal(REAL * quotient, REAL * remainder, REAL * a, REAL * b);
 
+// SAME OPERATIONS USING AN EXPLICIT CONTEXT
+// ALL ARGUMENTS MUST BE STORED IN THE REGISTERS OF THAT CONTEXT
+
+void addRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b);
+void subRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b);
+void mulRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b);
+void divRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * a, REAL * b);
+void divmodRealCtx(DECIMAL_CONTEXT * ctx, REAL * quotient, REAL * remainder,
+        REAL * a, REAL * b);
+
 // ROUND A REAL NUMBER TO A CERTAIN NUMBER OF DIGITS AFTER DECIMAL DOT
 // IF NFIGURES IS NEGATIVE, NFIGURES = TOTAL NUMBER OF SIGNIFICANT DIGITS
 // HANDLE SPECIALS
@@ -374,6 +441,8 @@ BINT getBINTReal(REAL * n);
 // EXTRACT A BINT64 FROM A REAL
 // MUST BE WITHIN RANGE
 BINT64 getBINT64Real(REAL * n);
+double getDoubleReal(REAL * n);
+void newRealFromDouble(REAL * result, double number, BINT digits);
 
 // CONVERT A REAL TO FORMATTED TEXT AS FOLLOWS:
 
@@ -27,8 +27,12 @@ void growDirs(WORD newtotalsize)
         newdir = halGrowMemory(MEM_AREA_DIR, Directories, newtotalsize);
 
         if(!newdir) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                if(gc_done)
+                    rplGCollect();
+                else
+                    rplGCollectMinor();
                 ++gc_done;
             }
             else {
@@ -44,6 +48,7 @@ void growDirs(WORD newtotalsize)
     DirsTop = DirsTop - Directories + newdir;
     Directories = newdir;
     DirSize = newtotalsize;
+    rplInvalidateIdentCache();
 }
 
 // SIMILAR TO GROW, BUT DOES NOT DO GARBAGE COLLECTION
@@ -64,6 +69,7 @@ void shrinkDirs(WORD newtotalsize)
     DirsTop = DirsTop - Directories + newdir;
     Directories = newdir;
     DirSize = newtotalsize;
+    rplInvalidateIdentCache();
 
 }
 
@@ -185,6 +191,189 @@ WORDPTR rplMakeIdentWriteable(WORDPTR ident)
 
 // DIRS STACK IS INCREASE AFTER FOR STORE, DECREASE BEFORE FOR READ
 
+// HASH INDEX FOR LARGE DIRECTORIES
+// EACH INDEXED DIRECTORY OWNS A POWER-OF-2 RANGE OF SLOTS IN DirIndexTable
+// SLOTS STORE THE POSITION OF THE VARIABLE COUNTING FROM THE END OF THE
+// DIRECTORY (1=LAST), SO CREATING NEW VARIABLES AT THE BEGINNING OF THE
+// DIRECTORY DOESN'T INVALIDATE THE EXISTING SLOTS. 0 MARKS AN EMPTY SLOT.
+// HANDLES ARE TempOb POINTERS, SO THE INDEX IS CLEARED ON EVERY GC
+
+// FNV-1a HASH OF AN IDENTIFIER TEXT, PADDED WITH ZEROS TO A FULL WORD
+static WORD rplDirIndexHash(BYTEPTR name, BYTEPTR nameend)
+{
+    WORD hash = 2166136261U;
+    BINT pad = (4 - ((nameend - name) & 3)) & 3;
+
+    while(name < nameend) {
+        hash ^= *name++;
+        hash *= 16777619U;
+    }
+    while(pad--)
+        hash *= 16777619U;
+    return hash;
+}
+
+// HASH OF THE NAME OF AN IDENT OBJECT, EXCLUDING THE ATTRIBUTES
+static WORD rplDirIndexHashIdent(WORDPTR ident)
+{
+    BINT nwords = OBJSIZE(*ident);
+    if(LIBNUM(*ident) & HASATTR_BIT)
+        --nwords;
+    return rplDirIndexHash((BYTEPTR) (ident + 1),
+            (BYTEPTR) (ident + 1 + nwords));
+}
+
+static void rplDirIndexInsert(BINT k, WORD hash, BINT pos)
+{
+    HALFWORD *table = DirIndexTable + DirIndexStart[k];
+    WORD slot = hash & DirIndexMask[k];
+
+    while(table[slot])
+        slot = (slot + 1) & DirIndexMask[k];
+    table[slot] = pos;
+}
+
+// DROP ALL INDEXES, MUST BE CALLED WHENEVER DIRECTORY HANDLES MOVE
+// ALSO FORGETS ALL IDENTS RESOLVED BY THE EVALUATION CACHE
+void rplClearDirIndex()
+{
+    BINT k;
+    for(k = 0; k < DIRINDEXDIRS; ++k)
+        DirIndexHandle[k] = 0;
+    DirIndexUsed = 0;
+    rplInvalidateIdentCache();
+}
+
+// DROP THE INDEX OF A DIRECTORY AFTER ITS ENTRIES WERE REMOVED OR REORDERED
+// THE INDEX WILL BE REBUILT ON THE NEXT LOOKUP
+// ALSO FORGETS ALL IDENTS RESOLVED BY THE EVALUATION CACHE
+void rplInvalidateDirIndex(WORDPTR * directory)
+{
+    BINT k;
+    rplInvalidateIdentCache();
+    if(!directory)
+        return;
+    for(k = 0; k < DIRINDEXDIRS; ++k)
+        if(DirIndexHandle[k] == directory[1])
+            DirIndexHandle[k] = 0;
+}
+
+// GET THE INDEX OF A DIRECTORY, BUILDING IT IF NEEDED
+// RETURNS -1 IF THE DIRECTORY CAN'T BE INDEXED
+static BINT rplDirIndexGet(WORDPTR * directory, BINT nitems)
+{
+    BINT k, size, pos;
+    WORDPTR *entry;
+
+    for(k = 0; k < DIRINDEXDIRS; ++k) {
+        if(DirIndexHandle[k] == directory[1]) {
+            if(DirIndexCount[k] == nitems)
+                return k;
+            DirIndexHandle[k] = 0;      // STALE, REBUILD IT
+            break;
+        }
+    }
+
+    // KEEP THE LOAD FACTOR UNDER 50% WHEN BUILT
+    size = 32;
+    while(size < 2 * nitems)
+        size <<= 1;
+    if(size > DIRINDEXSIZE)
+        return -1;
+
+    for(k = 0; k < DIRINDEXDIRS; ++k)
+        if(!DirIndexHandle[k])
+            break;
+    if((k == DIRINDEXDIRS) || (DirIndexUsed + size > DIRINDEXSIZE)) {
+        // OUT OF ROOM, START OVER
+        for(k = 0; k < DIRINDEXDIRS; ++k)
+            DirIndexHandle[k] = 0;
+        DirIndexUsed = 0;
+        k = 0;
+    }
+
+    DirIndexStart[k] = DirIndexUsed;
+    DirIndexMask[k] = size - 1;
+    for(pos = 0; pos < size; ++pos)
+        DirIndexTable[DirIndexUsed + pos] = 0;
+    DirIndexUsed += size;
+
+    // INSERT FROM THE BEGINNING, SO THE FIRST MATCH IS THE SAME A LINEAR SCAN WOULD FIND
+    entry = directory + 4;
+    pos = nitems;
+    while((entry < DirsTop) && (**entry != DIR_END_MARKER)) {
+        if(pos <= 0)
+            return -1;
+        if(ISIDENT(**entry))
+            rplDirIndexInsert(k, rplDirIndexHashIdent(*entry), pos);
+        entry += 2;
+        --pos;
+    }
+    if(pos)
+        return -1;      // CORRUPTED DIRECTORY, DON'T INDEX
+
+    DirIndexHandle[k] = directory[1];
+    DirIndexCount[k] = nitems;
+    return k;
+}
+
+// FIND A VARIABLE IN A SINGLE DIRECTORY USING ITS INDEX
+// COMPARE AGAINST nameobj IF GIVEN, OTHERWISE AGAINST THE TEXT name..nameend
+// RETURNS 1 IF THE INDEX WAS USED, WITH *result = ENTRY OR NULL IF NOT FOUND
+// RETURNS 0 IF THE DIRECTORY NEEDS TO BE SCANNED
+static BINT rplDirIndexFind(WORDPTR * directory, WORD hash, WORDPTR nameobj,
+        BYTEPTR name, BYTEPTR nameend, WORDPTR ** result)
+{
+    BINT nitems = *(directory[1] + 1);
+    BINT k;
+
+    if(nitems < DIRINDEXMINVARS)
+        return 0;
+    k = rplDirIndexGet(directory, nitems);
+    if(k < 0)
+        return 0;
+
+    HALFWORD *table = DirIndexTable + DirIndexStart[k];
+    WORD slot = hash & DirIndexMask[k];
+    WORDPTR *dirend = directory + 4 + 2 * nitems;
+    WORDPTR *entry;
+
+    while(table[slot]) {
+        entry = dirend - 2 * table[slot];
+        if(nameobj ? rplCompareIDENT(*entry, nameobj) :
+                rplCompareIDENTByName(*entry, name, nameend)) {
+            *result = entry;
+            return 1;
+        }
+        slot = (slot + 1) & DirIndexMask[k];
+    }
+
+    *result = 0;
+    return 1;
+}
+
+// ADD THE FIRST ENTRY OF A DIRECTORY TO ITS INDEX, AFTER IT WAS CREATED
+static void rplDirIndexAdd(WORDPTR * directory, WORDPTR nameobj)
+{
+    BINT nitems = *(directory[1] + 1);
+    BINT k;
+
+    for(k = 0; k < DIRINDEXDIRS; ++k) {
+        if(DirIndexHandle[k] == directory[1]) {
+            if((DirIndexCount[k] != nitems - 1)
+                    || (4 * nitems > 3 * (DirIndexMask[k] + 1))) {
+                // OUT OF SYNC OR TOO FULL, REBUILD ON NEXT LOOKUP
+                DirIndexHandle[k] = 0;
+                return;
+            }
+            if(ISIDENT(*nameobj))
+                rplDirIndexInsert(k, rplDirIndexHashIdent(nameobj), nitems);
+            DirIndexCount[k] = nitems;
+            return;
+        }
+    }
+}
+
 // CREATE A GLOBAL IN THE GIVEN DIRECTORY
 
 void rplCreateGlobalInDir(WORDPTR nameobj, WORDPTR value, WORDPTR * parentdir)
@@ -200,6 +389,8 @@ void rplCreateGlobalInDir(WORDPTR nameobj, WORDPTR value, WORDPTR * parentdir)
     // PATCH THE CURRENT DIRECTORY SIZE
     WORDPTR size = *(parentdir + 1) + 1;
     ++*size;
+    rplDirIndexAdd(parentdir, nameobj);
+    rplInvalidateIdentCache();
 
     // FIX THE CURRENT DIR IN CASE IT MOVED
     if(CurrentDir >= direntry)
@@ -237,6 +428,8 @@ WORDPTR *rplCreateNGlobalsInDir(BINT n, WORDPTR * parentdir)
     // PATCH THE CURRENT DIRECTORY SIZE
     WORDPTR size = *(parentdir + 1) + 1;
     *size += n;
+    // NAMES ARE FILLED IN BY THE CALLER
+    rplInvalidateDirIndex(parentdir);
 
     // FIX THE CURRENT DIR IN CASE IT MOVED
     if(CurrentDir >= direntry)
@@ -348,13 +541,23 @@ WORDPTR *rplGetParentDir(WORDPTR * directory)
 WORDPTR *rplFindGlobalbyName(BYTEPTR name, BYTEPTR nameend, BINT scanparents)
 {
     WORDPTR *direntry = CurrentDir + 4;
+    WORDPTR *found;
     WORDPTR parentdir;
+    WORD hash = rplDirIndexHash(name, nameend);
 
     if(!CurrentDir)
         return 0;
 
     do {
-        parentdir = *(direntry - 3);
+        parentdir = *(direntry - 1);
+        if(rplDirIndexFind(direntry - 4, hash, 0, name, nameend, &found)) {
+            if(found)
+                return found;
+            direntry = rplFindDirbyHandle(parentdir);
+            if(direntry)
+                direntry += 4;
+            continue;
+        }
         while(direntry < DirsTop) {
             if(**direntry == DIR_END_MARKER)
                 break;
@@ -363,6 +566,8 @@ WORDPTR *rplFindGlobalbyName(BYTEPTR name, BYTEPTR nameend, BINT scanparents)
             direntry += 2;
         }
         direntry = rplFindDirbyHandle(parentdir);
+        if(direntry)
+            direntry += 4;
     }
     while(scanparents && direntry);
     return 0;
@@ -372,12 +577,22 @@ WORDPTR *rplFindGlobalbyNameInDir(BYTEPTR name, BYTEPTR nameend,
         WORDPTR * parent, BINT scanparents)
 {
     WORDPTR *direntry = parent + 4;
+    WORDPTR *found;
     WORDPTR parentdir;
+    WORD hash = rplDirIndexHash(name, nameend);
 
     if(!parent)
         return 0;
     do {
-        parentdir = *(direntry - 3);
+        parentdir = *(direntry - 1);
+        if(rplDirIndexFind(direntry - 4, hash, 0, name, nameend, &found)) {
+            if(found)
+                return found;
+            direntry = rplFindDirbyHandle(parentdir);
+            if(direntry)
+                direntry += 4;
+            continue;
+        }
         while(direntry < DirsTop) {
             if(**direntry == DIR_END_MARKER)
                 break;
@@ -386,6 +601,8 @@ WORDPTR *rplFindGlobalbyNameInDir(BYTEPTR name, BYTEPTR nameend,
             direntry += 2;
         }
         direntry = rplFindDirbyHandle(parentdir);
+        if(direntry)
+            direntry += 4;
     }
     while(scanparents && direntry);
     return 0;
@@ -394,13 +611,23 @@ WORDPTR *rplFindGlobalbyNameInDir(BYTEPTR name, BYTEPTR nameend,
 WORDPTR *rplFindGlobalInDir(WORDPTR nameobj, WORDPTR * parent, BINT scanparents)
 {
     WORDPTR *direntry = parent;
+    WORDPTR *found;
     WORDPTR parentdir;
+    BINT useindex = ISIDENT(*nameobj);
+    WORD hash = useindex ? rplDirIndexHashIdent(nameobj) : 0;
 
     if(!parent)
         return 0;
 
     do {
         parentdir = *(direntry + 3);
+        if(useindex
+                && rplDirIndexFind(direntry, hash, nameobj, 0, 0, &found)) {
+            if(found)
+                return found;
+            direntry = rplFindDirbyHandle(parentdir);
+            continue;
+        }
         direntry += 4;  // SKIP SELF REFERENCE AND PARENT DIR
         while(direntry < DirsTop) {
             if(**direntry == DIR_END_MARKER)
@@ -555,6 +782,7 @@ void rplPurgeForced(WORDPTR * var)
     // UPDATE THE DIRECTORY COUNT
     WORDPTR *dir = rplGetDirfromGlobal(var);
     --*(*(dir + 1) + 1);
+    rplInvalidateDirIndex(dir);
 
     if(CurrentDir >= var)
         CurrentDir -= 2;
@@ -819,6 +1047,7 @@ void rplWipeDir(WORDPTR * directory)
     }
 
     // DONE, THE GIVEN DIRECTORY NO LONGER EXISTS
+    rplClearDirIndex();
     return;
 
 }
@@ -147,3 +147,188 @@ UBINT64 sincosFPINT(FPINT angle)
     return (((UBINT64) ((UBINT) sin)) << 32) + ((UBINT64) ((UBINT) cos));
 
 }
+
+// FAST NUMERIC MODE
+// WHEN SYSTEM FLAG FL_FASTNUMERIC IS SET, REAL OPERATIONS IN THE HOT NUMERIC PATHS
+// ARE DONE IN BINARY double AND THE RESULT IS ROUNDED TO FASTNUM_DIGITS
+// ALL FUNCTIONS RETURN 1 WHEN THE RESULT WAS STORED, 0 WHEN THE CALLER MUST USE THE
+// DECIMAL ENGINE (FLAG NOT SET, ARGUMENTS OR RESULT OUT OF RANGE, OR NOT ENOUGH DIGITS
+// WOULD BE LEFT CORRECT)
+
+// LARGEST DECIMAL EXPONENT OF ARGUMENTS AND RESULTS, WELL WITHIN THE RANGE OF A double
+#define FASTNUM_MAXEXP      290
+// ADDITIONS THAT CANCEL MORE THAN 3 DIGITS LOSE TOO MUCH PRECISION
+#define FASTNUM_MAXCANCEL   1e3
+
+#define FASTABS(x) (((x) < 0.0) ? -(x) : (x))
+
+static BINT fastnumInRange(REAL * n)
+{
+    if(n->flags & (F_INFINITY | F_NOTANUMBER))
+        return 0;
+    if((n->len == 1) && (n->data[0] == 0))
+        return 1;
+    BINT digits = intdigitsReal(n);
+    return (digits < FASTNUM_MAXEXP) && (digits > -FASTNUM_MAXEXP);
+}
+
+static BINT fastnumResult(REAL * result, double r)
+{
+    double ar = FASTABS(r);
+
+    // REJECT NAN, INFINITY AND ANYTHING NEAR THE LIMITS OF THE FORMAT
+    if(r != r)
+        return 0;
+    if((ar > 1e290) || ((ar < 1e-290) && (ar != 0.0)))
+        return 0;
+
+    BINT digits = Context.precdigits;
+    if(digits > FASTNUM_DIGITS)
+        digits = FASTNUM_DIGITS;
+
+    newRealFromDouble(result, r, digits);
+    result->flags |= F_APPROX;
+    return 1;
+}
+
+// BINARY ARITHMETIC: FASTNUM_ADD, FASTNUM_SUB, FASTNUM_MUL AND FASTNUM_DIV
+// EXACT ARGUMENTS ARE LEFT TO THE DECIMAL ENGINE TO KEEP EXACT RESULTS
+
+BINT rplFastNumericBinary(BINT op, REAL * result, REAL * a, REAL * b)
+{
+    if(!rplTestSystemFlag(FL_FASTNUMERIC))
+        return 0;
+    if(!((a->flags | b->flags) & F_APPROX))
+        return 0;
+    if(!fastnumInRange(a) || !fastnumInRange(b))
+        return 0;
+
+    double x = getDoubleReal(a), y = getDoubleReal(b), r;
+
+    switch (op) {
+    case FASTNUM_ADD:
+        r = x + y;
+        break;
+    case FASTNUM_SUB:
+        r = x - y;
+        break;
+    case FASTNUM_MUL:
+        return fastnumResult(result, x * y);
+    case FASTNUM_DIV:
+        if(y == 0.0)
+            return 0;
+        return fastnumResult(result, x / y);
+    default:
+        return 0;
+    }
+
+    // CHECK FOR CANCELLATION
+    x = FASTABS(x);
+    y = FASTABS(y);
+    if(FASTABS(r) * FASTNUM_MAXCANCEL < ((x > y) ? x : y))
+        return 0;
+    return fastnumResult(result, r);
+}
+
+// TRANSCENDENTAL FUNCTIONS, ONLY WHEN THE HOST PROVIDES A MATH LIBRARY
+// ANGLES FOR FASTNUM_SIN, FASTNUM_COS, FASTNUM_TAN AND THE RESULT OF FASTNUM_ATAN
+// ARE IN THE GIVEN ANGLE MODE
+
+#ifdef __ENABLE_HOST_LIBM__
+
+#include <math.h>
+
+// LARGEST ANGLE IN RADIANS FOR TRIGONOMETRIC FUNCTIONS
+#define FASTNUM_MAXANGLE    16.0
+// SMALLEST RESULT OF ILL-CONDITIONED FUNCTIONS NEAR THEIR ZEROS (AND POLES FOR TAN)
+#define FASTNUM_MINRESULT   1e-2
+
+BINT rplFastNumericUnary(BINT op, REAL * result, REAL * x, BINT angmode)
+{
+    if(!rplTestSystemFlag(FL_FASTNUMERIC))
+        return 0;
+    if(!fastnumInRange(x))
+        return 0;
+
+    double v = getDoubleReal(x), r, angscale;
+
+    switch (angmode) {
+    case ANGLEDEG:
+        angscale = M_PI / 180.0;
+        break;
+    case ANGLEGRAD:
+        angscale = M_PI / 200.0;
+        break;
+    case ANGLERAD:
+        angscale = 1.0;
+        break;
+    default:
+        // DMS IS LEFT TO THE DECIMAL ENGINE
+        angscale = 0.0;
+        break;
+    }
+
+    switch (op) {
+    case FASTNUM_SQRT:
+        if(v < 0.0)
+            return 0;
+        return fastnumResult(result, sqrt(v));
+    case FASTNUM_EXP:
+        if(FASTABS(v) > 690.0)
+            return 0;
+        return fastnumResult(result, exp(v));
+    case FASTNUM_ALOG:
+        if(FASTABS(v) > 290.0)
+            return 0;
+        return fastnumResult(result, pow(10.0, v));
+    case FASTNUM_LN:
+        if(v <= 0.0)
+            return 0;
+        r = log(v);
+        break;
+    case FASTNUM_LOG:
+        if(v <= 0.0)
+            return 0;
+        r = log10(v);
+        break;
+    case FASTNUM_SIN:
+    case FASTNUM_COS:
+    case FASTNUM_TAN:
+        if(angscale == 0.0)
+            return 0;
+        v *= angscale;
+        if(FASTABS(v) > FASTNUM_MAXANGLE)
+            return 0;
+        if(op == FASTNUM_SIN)
+            r = sin(v);
+        else if(op == FASTNUM_COS)
+            r = cos(v);
+        else {
+            r = tan(v);
+            if(FASTABS(r) * FASTNUM_MINRESULT > 1.0)
+                return 0;
+        }
+        break;
+    case FASTNUM_ATAN:
+        if(angscale == 0.0)
+            return 0;
+        return fastnumResult(result, atan(v) / angscale);
+    default:
+        return 0;
+    }
+
+    // RESULTS NEAR A ZERO OF THE FUNCTION DON'T HAVE ENOUGH CORRECT DIGITS
+    if(FASTABS(r) < FASTNUM_MINRESULT)
+        return 0;
+    return fastnumResult(result, r);
+}
+
+#else
+
+BINT rplFastNumericUnary(BINT op, REAL * result, REAL * x, BINT angmode)
+{
+    // NO MATH LIBRARY ON THIS TARGET, ALWAYS USE THE DECIMAL ENGINE
+    return 0;
+}
+
+#endif
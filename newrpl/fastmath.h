@@ -31,6 +31,28 @@ extern FPINT mulFPINT(FPINT a, FPINT b);
 
 extern FPINT divFPINT(FPINT a, FPINT b);
 
+// FAST NUMERIC MODE (SYSTEM FLAG FL_FASTNUMERIC)
+// SIGNIFICANT DIGITS OF THE RESULTS WHEN COMPUTED IN BINARY double
+#define FASTNUM_DIGITS  12
+
+// OPERATIONS FOR rplFastNumericBinary() AND rplFastNumericUnary()
+enum
+{
+    FASTNUM_ADD = 0,
+    FASTNUM_SUB,
+    FASTNUM_MUL,
+    FASTNUM_DIV,
+    FASTNUM_SQRT,
+    FASTNUM_EXP,
+    FASTNUM_LN,
+    FASTNUM_LOG,
+    FASTNUM_ALOG,
+    FASTNUM_SIN,
+    FASTNUM_COS,
+    FASTNUM_TAN,
+    FASTNUM_ATAN
+};
+
 #define INT2FPINT(a) (((FPINT)(a))<<24)
 #define FPINT2INT(a) ((a)>>24)
 #define TRUNCFPINT(a) (((FPINT)(a))&~((1LL<<24)-1LL))
@@ -16,10 +16,11 @@
 #define CloseHole(hole,start,end) memmovew((hole),(start), (WORD)(end-start))
 
 // GET A TEMPBLOCK THAT CORRESPONDS OR CONTAINS THE GIVEN ADDRESS
+// ONLY BLOCKS STARTING AT first ARE SEARCHED
 
-WORDPTR *GetTempBlock(WORDPTR block)
+WORDPTR *GetTempBlock(WORDPTR block, WORDPTR * first)
 {
-    WORDPTR *left = TempBlocks;
+    WORDPTR *left = first;
     WORDPTR *right = TempBlocksEnd;
     WORDPTR *guess;
     do {
@@ -40,15 +41,16 @@ WORDPTR *GetTempBlock(WORDPTR block)
 }
 
 // MARK ALL ADDRESSES IN TEMPBLOCK THAT ARE BEING REFERENCED
+// ONLY BLOCKS STARTING AT first (AT ADDRESS firstaddr) ARE MARKED
 
-void Mark(WORDPTR * start, WORDPTR * end)
+void Mark(WORDPTR * start, WORDPTR * end, WORDPTR * first, WORDPTR firstaddr)
 {
     WORDPTR *blockptr;
     while(start != end) {
 
-        if((*start >= TempOb) && (*start < TempObEnd)) {
+        if((*start >= firstaddr) && (*start < TempObEnd)) {
             // ONLY SEARCH POINTERS THAT POINT TO TEMPOB
-            blockptr = GetTempBlock(*start);
+            blockptr = GetTempBlock(*start, first);
             if(((WORDPTR) ((PTR2NUMBER) * blockptr & ~((PTR2NUMBER) 3))) ==
                     *start)
                 *blockptr = (WORDPTR) ((PTR2NUMBER) * blockptr | 1);
@@ -114,14 +116,78 @@ void Patch(WORDPTR * start, WORDPTR * end, WORDPTR startfrom, WORDPTR endfrom,
 
 }
 
-// HIGH LEVEL GARBAGE COLLECTOR CALL
-void rplGCollect()
+// PATCH ALL POINTERS IN AN AREA USING THE RELOCATION TABLE
+// RUNS IN THE TABLE ARE SORTED BY ADDRESS AND DON'T OVERLAP
+
+void PatchRelocs(WORDPTR * start, WORDPTR * end)
+{
+    WORDPTR lowest = GCRelocStart[0];
+    WORDPTR highest = GCRelocEnd[GCNumRelocs - 1];
+    BINT lo, hi, x;
+
+    while(start != end) {
+
+        if((*start >= lowest) && (*start < highest)) {
+            // BINARY SEARCH FOR THE LAST RUN STARTING AT OR BEFORE THE POINTER
+            lo = 0;
+            hi = GCNumRelocs - 1;
+            while(lo < hi) {
+                x = (lo + hi + 1) / 2;
+                if(GCRelocStart[x] <= *start)
+                    lo = x;
+                else
+                    hi = x - 1;
+            }
+            if(*start < GCRelocEnd[lo])
+                *start += GCRelocOffset[lo];
+        }
+        ++start;
+    }
+
+}
+
+// PATCH ALL ROOTS WITH THE PENDING RELOCATIONS AND EMPTY THE TABLE
+
+void FlushRelocs(WORDPTR * EndOfRStk)
+{
+    if(!GCNumRelocs)
+        return;
+
+    PatchRelocs(DStk, DSTop);   // DATA STACK
+
+    PatchRelocs(RStk, EndOfRStk);       // RETURN STACK
+
+    PatchRelocs(LAMs, LAMTop);  // LOCAL VARIABLES
+
+    PatchRelocs(Directories, DirsTop);  // GLOBAL VARIABLES
+
+    PatchRelocs(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE); // SYSTEM POINTERS
+
+    PatchRelocs(halCacheBitmap, halCacheBitmap + MAX_RENDERCACHE_ENTRIES);     // RENDERED OBJECTS
+
+    GCNumRelocs = 0;
+}
+
+// COLLECT EITHER ALL OF TEMPOB (FULL) OR ONLY THE YOUNG GENERATION (MINOR)
+// OBJECTS DON'T CONTAIN POINTERS TO OTHER OBJECTS, SO THE ROOTS ARE THE SAME
+// FOR BOTH KINDS. A MINOR COLLECTION SIMPLY LEAVES ALL OLD BLOCKS ALONE
+
+static void GCollect(BINT minor)
 {
     // FIRST, INITIALIZE THE COLLECTOR
     WORDPTR EndOfUsedMem, *EndOfRStk;
     int CompileBlock = 0;
+    tmr_t StartTicks = tmr_ticks();
+    WORDPTR *FirstBlock, FirstAddr;
+    BINT NumBlocks, k, Survivors[GCPROMOTEAGE];
 
     GCFlags = GC_IN_PROGRESS;
+    GCNumRelocs = 0;
+    // DIRECTORY HANDLES MAY MOVE, DROP THE HASH INDEX
+    rplClearDirIndex();
+    // SO CAN LISTS
+    rplClearListIndex();
+    NumBlocks = TempBlocksEnd - TempBlocks;
 
     // FOR DEBUG ONLY, VERIFY THAT AL TEMPBLOCKS ARE VALID
     //CheckTempBlocks();
@@ -155,17 +221,48 @@ void rplGCollect()
 
     *TempBlocksEnd = EndOfUsedMem;      // STORE THE END OF LAST BLOCK FOR CONVENIENCE (MARKED AS UNUSED)
 
+    if(minor) {
+        // BLOCKS MAY HAVE BEEN RELEASED SINCE THE LAST COLLECTION
+        for(k = 0; k < GCPROMOTEAGE; ++k)
+            if(GCAgeBlocks[k] > NumBlocks)
+                GCAgeBlocks[k] = NumBlocks;
+        FirstBlock = TempBlocks + GCAgeBlocks[0];
+    }
+    else
+        FirstBlock = TempBlocks;
+    FirstAddr = (WORDPTR) (((PTR2NUMBER) * FirstBlock) & ~((PTR2NUMBER) 3));
+    // CACHED SYMBOLIC FORMS IN THE COLLECTED AREA MAY MOVE OR DIE
+    rplReleaseSymbCache(minor ? FirstAddr : TempOb);
+
     // MARK
 
-    Mark(DStk, DSTop);  // DATA STACK
+    Mark(DStk, DSTop, FirstBlock, FirstAddr);   // DATA STACK
 
-    Mark(RStk, RSTop);  // RETURN STACK
+    Mark(RStk, RSTop, FirstBlock, FirstAddr);   // RETURN STACK
 
-    Mark(LAMs, LAMTop); // LOCAL VARIABLES
+    Mark(LAMs, LAMTop, FirstBlock, FirstAddr);  // LOCAL VARIABLES
 
-    Mark(Directories, DirsTop); // GLOBAL VARIABLES
+    Mark(Directories, DirsTop, FirstBlock, FirstAddr);  // GLOBAL VARIABLES
 
-    Mark(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE);        // SYSTEM POINTERS
+    Mark(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE, FirstBlock, FirstAddr); // SYSTEM POINTERS
+
+    Mark(halCacheBitmap, halCacheBitmap + MAX_RENDERCACHE_ENTRIES, FirstBlock, FirstAddr);     // RENDERED OBJECTS
+
+    if(minor) {
+        // COUNT THE SURVIVORS OF EACH AGE BEFORE THE SWEEP CLEANS THE MARKS
+        for(k = 0; k < GCPROMOTEAGE; ++k) {
+            WORDPTR *ptr = TempBlocks + GCAgeBlocks[k];
+            WORDPTR *endptr =
+                    TempBlocks + ((k + 1 <
+                        GCPROMOTEAGE) ? GCAgeBlocks[k + 1] : NumBlocks);
+            Survivors[k] = 0;
+            while(ptr < endptr) {
+                if(((PTR2NUMBER) (*ptr)) & 3)
+                    ++Survivors[k];
+                ++ptr;
+            }
+        }
+    }
 
 //    CheckPTR(GC_PTRUpdate,GC_PTRUpdate+MAX_GC_PTRUPDATE);       // SYSTEM POINTERS
 //    CheckTempBlocks();
@@ -175,7 +272,7 @@ void rplGCollect()
     WORDPTR *CheckIdx, *CleanIdx;
     BINT Offset;
 
-    CheckIdx = TempBlocks;
+    CheckIdx = FirstBlock;
 
     // FIND THE FIRST HOLE
     while(((PTR2NUMBER) (*CheckIdx)) & 3) {
@@ -192,6 +289,9 @@ void rplGCollect()
 
             if(CheckIdx == TempBlocksEnd) {
 
+                // PATCH ALL POINTERS TO THE BLOCKS MOVED SO FAR
+                FlushRelocs(EndOfRStk);
+
                 EndOfUsedMem = EndBlock;
                 // REMOVE PHANTOM BLOCK USING DURING COMPILE/DECOMPILE
                 if(CompileBlock) {
@@ -212,6 +312,18 @@ void rplGCollect()
                 // TRUNCATE TEMPBLOCKS
                 TempBlocksEnd = CleanIdx;
 
+                if(minor) {
+                    // SURVIVORS GET ONE COLLECTION OLDER, THE OLDEST ONES ARE PROMOTED
+                    GCAgeBlocks[0] += Survivors[0];
+                    for(k = 1; k < GCPROMOTEAGE; ++k)
+                        GCAgeBlocks[k] = GCAgeBlocks[k - 1] + Survivors[k];
+                }
+                else {
+                    // EVERYTHING THAT SURVIVES A FULL COLLECTION IS OLD
+                    for(k = 0; k < GCPROMOTEAGE; ++k)
+                        GCAgeBlocks[k] = TempBlocksEnd - TempBlocks;
+                }
+
 //            CheckPTR(GC_PTRUpdate,GC_PTRUpdate+MAX_GC_PTRUPDATE);       // SYSTEM POINTERS
 //            CheckTempBlocks();
 
@@ -230,7 +342,13 @@ void rplGCollect()
                 //halCheckMemoryMap();
                 //halCheckRplMemory();
 
-                GCFlags = GC_COMPLETED;
+                // ALL ROOTS WERE PATCHED, INCLUDING THE RENDER CACHE, SO THERE'S
+                // NOTHING LEFT TO INVALIDATE
+                GCFlags = 0;
+
+                StartTicks = tmr_ticks() - StartTicks;
+                if(StartTicks > GCMaxPause)
+                    GCMaxPause = StartTicks;
 
                 return;
             }
@@ -259,21 +377,94 @@ void rplGCollect()
 
         CloseHole(EndBlock, StartBlock, *CheckIdx);
 
-        // PATCH ALL POINTERS
+        // RECORD THE RUN, ALL POINTERS ARE PATCHED LATER IN A SINGLE PASS
+        // NEW LOCATIONS ARE ALWAYS BELOW ANY PENDING RUN, SO NO POINTER IS PATCHED TWICE
 
-        Patch(DStk, DSTop, StartBlock, *CheckIdx, Offset);      // DATA STACK
+        if(GCNumRelocs >= GCRELOCSIZE)
+            FlushRelocs(EndOfRStk);
 
-        Patch(RStk, EndOfRStk, StartBlock, *CheckIdx, Offset);  // RETURN STACK
+        GCRelocStart[GCNumRelocs] = StartBlock;
+        GCRelocEnd[GCNumRelocs] = *CheckIdx;
+        GCRelocOffset[GCNumRelocs] = Offset;
+        ++GCNumRelocs;
 
-        Patch(LAMs, LAMTop, StartBlock, *CheckIdx, Offset);     // LOCAL VARIABLES
+        EndBlock = *CheckIdx + Offset;  // END OF THE NEW COMPACTED BLOCK
 
-        Patch(Directories, DirsTop, StartBlock, *CheckIdx, Offset);     // GLOBAL VARIABLES
+    }
+    while(1);
 
-        Patch(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE, StartBlock, *CheckIdx, Offset);    // SYSTEM POINTERS
+}
 
-        EndBlock = *CheckIdx + Offset;  // END OF THE NEW COMPACTED BLOCK
+// HIGH LEVEL GARBAGE COLLECTOR CALL
+void rplGCollect()
+{
+    GCollect(0);
+}
+
+// COLLECT ONLY OBJECTS ALLOCATED SINCE THE LAST FEW COLLECTIONS
+// CHEAPER THAN rplGCollect BUT OLD GARBAGE IS NOT RELEASED
+void rplGCollectMinor()
+{
+    GCollect(1);
+}
 
+// RETURN TRUE IF ANY POINTER IN THE AREA POINTS WITHIN start..end
+// EXCEPT THE ONE AT skip
+
+static BINT IsReferenced(WORDPTR * start, WORDPTR * end, WORDPTR * skip,
+        WORDPTR from, WORDPTR to)
+{
+    while(start != end) {
+        if((*start >= from) && (*start < to) && (start != skip))
+            return 1;
+        ++start;
     }
-    while(1);
+    return 0;
+}
 
+// CHECK IF THE POINTER AT owner IS THE ONLY REFERENCE TO AN OBJECT IN TEMPOB
+// SCANS THE SAME ROOTS AS THE COLLECTOR, POINTERS TO ANY OBJECT EMBEDDED
+// IN THE OBJECT ALSO COUNT AS REFERENCES
+// WHEN TRUE, THE OBJECT CAN BE MODIFIED IN PLACE
+
+BINT rplIsSoleReference(WORDPTR * owner)
+{
+    WORDPTR object = *owner, end;
+    WORDPTR *block;
+
+    if((object < TempOb) || (object >= TempObEnd))
+        return 0;
+
+    // MUST BE A BLOCK ON ITS OWN, NOT AN OBJECT EMBEDDED IN ANOTHER ONE
+    block = GetTempBlock(object, TempBlocks);
+    if(*block != object)
+        return 0;
+    end = object + rplObjSize(object);
+
+    if(IsReferenced(DStk, DSTop, owner, object, end))
+        return 0;
+    if(IsReferenced(RStk, RSTop, owner, object, end))
+        return 0;
+    if(IsReferenced(LAMs, LAMTop, owner, object, end))
+        return 0;
+    if(IsReferenced(Directories, DirsTop, owner, object, end))
+        return 0;
+    // SCRATCH POINTERS ARE ONLY VALID WITHIN A SINGLE COMMAND, SKIP THEM
+    if(IsReferenced(GC_PTRUpdate, &ScratchPointer1, owner, object, end))
+        return 0;
+    if(IsReferenced(&ScratchPointer5 + 1, GC_PTRUpdate + MAX_GC_PTRUPDATE,
+                owner, object, end))
+        return 0;
+    if(IsReferenced(halCacheBitmap, halCacheBitmap + MAX_RENDERCACHE_ENTRIES,
+                owner, object, end))
+        return 0;
+    return 1;
+}
+
+// FORGET ALL GENERATIONS, NEXT MINOR COLLECTION WILL SWEEP ALL OF TEMPOB
+void rplGCResetGenerations()
+{
+    BINT k;
+    for(k = 0; k < GCPROMOTEAGE; ++k)
+        GCAgeBlocks[k] = 0;
 }
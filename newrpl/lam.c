@@ -31,8 +31,12 @@ void growLAMs(WORD newtotalsize)
         newlam = halGrowMemory(MEM_AREA_LAM, LAMs, newtotalsize);
 
         if(!newlam) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                if(gc_done)
+                    rplGCollect();
+                else
+                    rplGCollectMinor();
                 ++gc_done;
             }
             else {
@@ -48,6 +52,7 @@ void growLAMs(WORD newtotalsize)
     nLAMBase = nLAMBase - LAMs + newlam;
     LAMs = newlam;
     LAMSize = newtotalsize;
+    rplInvalidateIdentCache();
 }
 
 void shrinkLAMs(WORD newtotalsize)
@@ -67,6 +72,7 @@ void shrinkLAMs(WORD newtotalsize)
     nLAMBase = nLAMBase - LAMs + newlam;
     LAMs = newlam;
     LAMSize = newtotalsize;
+    rplInvalidateIdentCache();
 }
 
 // LAM STACK IS INCREASE AFTER FOR STORE, DECREASE BEFORE FOR READ
@@ -75,6 +81,7 @@ BINT rplCreateLAM(WORDPTR nameobj, WORDPTR value)
 {
     *LAMTop++ = nameobj;
     *LAMTop++ = value;
+    rplInvalidateIdentCache();
 
     if(LAMSize <= LAMTop - LAMs + LAMSLACK)
         growLAMs((WORD) (LAMTop - LAMs + LAMSLACK + 1024));
@@ -237,6 +244,52 @@ WORDPTR *rplFindLAM(WORDPTR nameobj, BINT scanparents)
     return 0;
 }
 
+// FORGET ALL RESOLVED IDENTS
+// MUST BE CALLED WHENEVER A LAM IS CREATED OR RENAMED, WHEN DIRECTORY ENTRIES
+// ARE CREATED, REMOVED OR MOVED, AND WHEN TEMPOB MOVES (CALL SITES ARE KEYED
+// BY ADDRESS, rplClearDirIndex() TAKES CARE OF IT IN growTempOb/shrinkTempOb)
+void rplInvalidateIdentCache()
+{
+    ++IdentGeneration;
+    if(!IdentGeneration) {
+        // GENERATION WRAPPED AROUND, OLD ENTRIES COULD LOOK VALID AGAIN
+        BINT k;
+        for(k = 0; k < IDENTCACHESIZE; ++k)
+            IdentCacheSite[k] = 0;
+    }
+}
+
+// RESOLVE AN IDENT BEING EXECUTED FROM A PROGRAM, AS A LAM FIRST, THEN AS A GLOBAL
+// THE RESULT IS REMEMBERED PER CALL SITE (ADDRESS OF THE IDENT), SO A LOOP
+// EVALUATING THE SAME IDENT DOESN'T SCAN LAMS AND DIRECTORIES EVERY TIME
+// RETURN THE KEY/VALUE PAIR, OR NULL IF THE IDENT IS NOT DEFINED
+WORDPTR *rplFindIdentCached(WORDPTR ident)
+{
+    BINT slot = (BINT) (((PTR2NUMBER) ident >> 2) & (IDENTCACHESIZE - 1));
+    WORDPTR *var;
+
+    // NEW LAMS AND CHANGES IN THE CURRENT DIRECTORY MOVE LAMTop OR CurrentDir
+    // EVERYTHING ELSE INCREASES THE GENERATION
+    if((IdentCacheSite[slot] == ident)
+            && (IdentCacheGen[slot] == IdentGeneration)
+            && (IdentCacheLAMTop[slot] == LAMTop)
+            && (IdentCacheDir[slot] == CurrentDir))
+        return IdentCacheVar[slot];
+
+    var = rplFindLAM(ident, 1);
+    if(!var)
+        var = rplFindGlobal(ident, 1);
+    if(!var)
+        return 0;
+
+    IdentCacheSite[slot] = ident;
+    IdentCacheVar[slot] = var;
+    IdentCacheLAMTop[slot] = LAMTop;
+    IdentCacheDir[slot] = CurrentDir;
+    IdentCacheGen[slot] = IdentGeneration;
+    return var;
+}
+
 // RECLAIMS A LAM VALUE, FROM CURRENT SECO OR PARENTS
 
 WORDPTR rplGetLAM(WORDPTR nameobj)
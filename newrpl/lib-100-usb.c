@@ -821,8 +821,8 @@ void LIB_HANDLER()
     }
 
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
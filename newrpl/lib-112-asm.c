@@ -468,6 +468,296 @@ BINT rplAsmDecodeToken(BYTEPTR start, BYTEPTR end, BINT * opcode_arg)
     return 0;
 }
 
+// *******************************************
+// *** COMPILER FOR NUMERIC USER FUNCTIONS ***
+// *******************************************
+
+// ARGUMENTS AS ENCODED IN THE OPCODES
+#define ASMARG_P        8       // INLINE LITERAL FOR Y AND Z, PUSH FOR D
+#define ASMARG_S(n)     (8+(n)) // STACK LEVELS S1 TO S7
+#define ASMARG_LIT(n)   (16+(n))        // LITERALS #0 TO #15
+#define ASMARG_NONE     0x20
+
+#define ASMMKOPCODE(sto,oper,d,y,z) MKOPCODE(LIBRARY_NUMBER+(sto), \
+    ((z)&0xf)|(((z)&0x10)<<8)|(((y)&0xf)<<4)|(((y)&0x10)<<9)|(((d)&0xf)<<8)|(((oper)&0x1f)<<14))
+
+// DROP STACK LEVEL 1
+#define ASM_DROP1 ASMMKOPCODE(ASMSTO_NOOP,ASM_POP,0,ASMARG_LIT(1),ASMARG_LIT(1))
+
+typedef struct
+{
+    WORDPTR out;        // WHERE TO WRITE THE CODE, NULL TO ONLY MEASURE IT
+    BINT size;  // NUMBER OF WORDS OF CODE SO FAR
+    WORDPTR firstarg;   // NAME OF THE FIRST ARGUMENT OF THE FUNCTION
+    BINT nargs;
+} ASMCOMPILER;
+
+static void rplAsmEmit(ASMCOMPILER * c, WORD opcode)
+{
+    if(c->out)
+        c->out[c->size] = opcode;
+    ++c->size;
+}
+
+static void rplAsmEmitObject(ASMCOMPILER * c, WORDPTR object)
+{
+    if(c->out)
+        rplCopyObject(c->out + c->size, object);
+    c->size += rplObjSize(object);
+}
+
+// PEEL OFF SYMBOLIC WRAPPERS AROUND A SINGLE OBJECT
+static WORDPTR rplAsmStripSymb(WORDPTR object)
+{
+    while(ISSYMBOLIC(*object)) {
+        object = rplSymbUnwrap(object);
+        if(rplSymbMainOperator(object))
+            break;
+        ++object;
+    }
+    return object;
+}
+
+// RETURN THE Y/Z ARGUMENT THAT READS A SIMPLE VALUE IN PLACE:
+// A FUNCTION ARGUMENT OR A NUMBER. RETURN -1 FOR ANY OTHER OBJECT
+// depth IS THE NUMBER OF VALUES ON THE STACK ABOVE THE FUNCTION ARGUMENTS
+static BINT rplAsmSimpleArg(ASMCOMPILER * c, WORDPTR object, BINT depth)
+{
+    BINT k;
+    WORDPTR name;
+
+    if(ISBINT(*object) || ISREAL(*object) || ISCOMPLEX(*object))
+        return ASMARG_P;
+    if(!ISIDENT(*object))
+        return -1;
+    for(k = 0, name = c->firstarg; k < c->nargs; ++k, name = rplSkipOb(name)) {
+        if(rplCompareIDENT(name, object)) {
+            if(c->nargs - k + depth > 7)
+                return -1;      // OUT OF REACH OF THE STACK REFERENCES
+            return ASMARG_S(c->nargs - k + depth);
+        }
+    }
+    return -1;  // A GLOBAL VARIABLE, CAN'T BE COMPILED
+}
+
+// EMIT CODE THAT PUSHES THE VALUE OF THE EXPRESSION ON THE STACK
+// OPERATIONS ARE DONE IN THE SAME ORDER THE SYMBOLIC EVALUATOR WOULD DO THEM
+// RETURN 0 IF THE EXPRESSION CAN'T BE COMPILED
+static BINT rplAsmCompileExpr(ASMCOMPILER * c, WORDPTR expr, BINT depth)
+{
+    BINT arg, nops, k, oper;
+    WORD opcode;
+    WORDPTR ptr, last, end;
+
+    if(depth > 7)
+        return 0;       // TOO DEEP, KEEP WITHIN THE STACK SLACK
+    expr = rplAsmStripSymb(expr);
+    arg = rplAsmSimpleArg(c, expr, depth);
+    if(arg >= 0) {
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, ASM_LDY, ASMARG_P, arg,
+                    ASMARG_NONE));
+        if(arg == ASMARG_P)
+            rplAsmEmitObject(c, expr);
+        return 1;
+    }
+    if(!ISSYMBOLIC(*expr))
+        return 0;
+
+    opcode = expr[1];
+    end = rplSkipOb(expr);
+    last = ptr = expr + 2;
+    for(nops = 0; ptr < end; ++nops, ptr = rplSkipOb(ptr))
+        last = ptr;
+    ptr = expr + 2;
+
+    switch (opcode) {
+    case CMD_OVR_ADD:
+        oper = ASM_ADD;
+        break;
+    case CMD_OVR_MUL:
+        oper = ASM_MUL;
+        break;
+    case CMD_OVR_SUB:
+        oper = ASM_SUB;
+        break;
+    case CMD_OVR_DIV:
+        oper = ASM_DIV;
+        break;
+    case CMD_OVR_POW:
+        oper = ASM_POW;
+        break;
+    case CMD_OVR_UPLUS:
+        if(nops != 1)
+            return 0;
+        return rplAsmCompileExpr(c, ptr, depth);
+    case CMD_OVR_NEG:
+    case CMD_OVR_UMINUS:
+        // :S1=#0-S1
+        if((nops != 1) || !rplAsmCompileExpr(c, ptr, depth))
+            return 0;
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, ASM_SUB, ASMARG_S(1),
+                    ASMARG_LIT(0), ASMARG_S(1)));
+        return 1;
+    default:
+        // :S1=CMD.S1 FOR FUNCTIONS OF ONE ARGUMENT
+        if(nops != 1)
+            return 0;
+        for(k = 0; k < (BINT) (sizeof(mathcmd_table) / sizeof(WORD)); ++k)
+            if(mathcmd_table[k] == opcode)
+                break;
+        if(k < (BINT) (sizeof(mathcmd_table) / sizeof(WORD)))
+            oper = ASM_MATH;
+        else {
+            for(k = 0; k < (BINT) (sizeof(math2cmd_table) / sizeof(WORD));
+                    ++k)
+                if(math2cmd_table[k] == opcode)
+                    break;
+            if(k == (BINT) (sizeof(math2cmd_table) / sizeof(WORD)))
+                return 0;
+            oper = ASM_MATH2;
+        }
+        if(!rplAsmCompileExpr(c, ptr, depth))
+            return 0;
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, oper, ASMARG_S(1),
+                    ASMARG_LIT(k), ASMARG_S(1)));
+        return 1;
+    }
+
+    // BINARY OPERATORS, ADDITION AND MULTIPLICATION MAY HAVE MORE OPERANDS
+    if((nops < 2) || ((nops > 2) && (oper != ASM_ADD) && (oper != ASM_MUL)))
+        return 0;
+
+    for(k = 0; k < nops - 1; ++k, ptr = rplSkipOb(ptr))
+        if(!rplAsmCompileExpr(c, ptr, depth + k))
+            return 0;
+
+    // THE LAST OPERAND IS USED IN PLACE WHEN POSSIBLE
+    arg = rplAsmSimpleArg(c, rplAsmStripSymb(last), depth + nops - 1);
+    if(arg >= 0) {
+        // :S1=S1.OP.ARG
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, oper, ASMARG_S(1),
+                    ASMARG_S(1), arg));
+        if(arg == ASMARG_P)
+            rplAsmEmitObject(c, rplAsmStripSymb(last));
+    }
+    else {
+        if(!rplAsmCompileExpr(c, last, depth + nops - 1))
+            return 0;
+        // :S2=S2.OP.S1 AND DROP S1
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, oper, ASMARG_S(2),
+                    ASMARG_S(2), ASMARG_S(1)));
+        rplAsmEmit(c, ASM_DROP1);
+    }
+
+    // THE SYMBOLIC EVALUATOR FOLDS THE REMAINING OPERANDS FROM THE RIGHT
+    for(k = 2; k < nops; ++k) {
+        rplAsmEmit(c, ASMMKOPCODE(ASMSTO_STO, oper, ASMARG_S(2),
+                    ASMARG_S(2), ASMARG_S(1)));
+        rplAsmEmit(c, ASM_DROP1);
+    }
+    return 1;
+}
+
+// FIND THE ARGUMENTS AND THE BODY OF A USER FUNCTION 'f(X,Y,...)=EXPRESSION'
+// RETURN THE NUMBER OF ARGUMENTS, OR -1 IF IT'S NOT A USER FUNCTION
+static BINT rplAsmParseUserFunc(WORDPTR userfunc, WORDPTR * firstarg,
+        WORDPTR * body)
+{
+    WORDPTR ptr, endofcall;
+    BINT nargs = 0;
+
+    if(!ISSYMBOLIC(*userfunc))
+        return -1;
+    userfunc = rplSymbUnwrap(userfunc);
+    if((OBJSIZE(*userfunc) <= 3) || (userfunc[1] != CMD_EQUATIONOPERATOR)
+            || !ISSYMBOLIC(userfunc[2]) || (userfunc[3] != CMD_OVR_FUNCEVAL))
+        return -1;
+    ptr = *firstarg = userfunc + 4;
+    endofcall = rplSkipOb(userfunc + 2);
+    while(rplSkipOb(ptr) < endofcall) {
+        if(!ISIDENT(*ptr))
+            return -1;
+        ++nargs;
+        ptr = rplSkipOb(ptr);
+    }
+    *body = endofcall;
+    if(rplSkipOb(*body) != rplSkipOb(userfunc))
+        return -1;
+    return nargs;
+}
+
+// COMPILE A USER FUNCTION IN THE FORM 'f(X,Y,...)=EXPRESSION' TO A PROGRAM
+// MADE OF ASSEMBLY INSTRUCTIONS. THE PROGRAM TAKES THE ARGUMENTS FROM THE STACK
+// AND REPLACES THEM WITH THE NUMERIC VALUE OF THE EXPRESSION, WITHOUT CREATING
+// LOCAL VARIABLES OR TOUCHING THE USER REGISTERS
+// ONLY ARITHMETIC AND THE FUNCTIONS KNOWN TO THE ASSEMBLER ARE COMPILED
+// RETURN 0 IF THE FUNCTION CAN'T BE COMPILED
+WORDPTR rplAsmCompileUserFunc(WORDPTR userfunc)
+{
+    ASMCOMPILER c;
+    WORDPTR body, code;
+
+    c.nargs = rplAsmParseUserFunc(userfunc, &c.firstarg, &body);
+    if((c.nargs < 0) || (c.nargs > 7))
+        return 0;
+
+    // FIRST PASS TO MEASURE THE CODE
+    c.out = 0;
+    c.size = 0;
+    if(!rplAsmCompileExpr(&c, body, 0))
+        return 0;
+    if(c.nargs)
+        rplAsmEmit(&c, 0);      // FINAL CLEANUP OF THE ARGUMENTS
+
+    ScratchPointer1 = userfunc;
+    code = rplAllocTempOb(c.size + 1);
+    userfunc = ScratchPointer1;
+    if(!code)
+        return 0;
+
+    // SECOND PASS WRITES THE CODE
+    c.nargs = rplAsmParseUserFunc(userfunc, &c.firstarg, &body);
+    c.out = code + 1;
+    c.size = 0;
+    rplAsmCompileExpr(&c, body, 0);
+    if(c.nargs) {
+        // :POP.#2.#n REMOVES THE ARGUMENTS BELOW THE RESULT
+        rplAsmEmit(&c, ASMMKOPCODE(ASMSTO_NOOP, ASM_POP, 0, ASMARG_LIT(2),
+                    ASMARG_LIT(c.nargs)));
+    }
+    rplAsmEmit(&c, CMD_SEMI);
+    code[0] = MKPROLOG(DOCOL, c.size);
+
+    return code;
+}
+
+// RUN CODE COMPILED BY rplAsmCompileUserFunc() WITHOUT GOING THROUGH THE MAIN
+// RPL LOOP. THE ARGUMENTS MUST BE NUMBERS ALREADY IN THE STACK
+void rplAsmRunCode(WORDPTR code)
+{
+    WORD savedopcode = CurOpcode;
+
+    rplExpandStack(16); // ALL INSTRUCTIONS PUSH WITHOUT GROWING THE STACK
+    if(Exceptions)
+        return;
+    rplPushRet(IPtr);
+    rplClrSystemFlag(FL_FORCED_RAD);
+
+    // IPtr IS UPDATED BY THE GC IF THE CODE MOVES
+    IPtr = code + 1;
+    while(*IPtr != CMD_SEMI) {
+        CurOpcode = *IPtr;
+        LIB_HANDLER();
+        if(Exceptions)
+            break;
+        // INSTRUCTIONS WITH INLINE LITERALS LEAVE IPtr AT THE LITERAL
+        IPtr += 1 + ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) : 0);
+    }
+
+    IPtr = rplPopRet();
+    CurOpcode = savedopcode;
+}
+
 void LIB_HANDLER()
 {
     if(ISPROLOG(CurOpcode)) {
@@ -2592,13 +2882,7 @@ void LIB_HANDLER()
                 rplCompileAppend(MKOPCODE(LIBRARY_NUMBER + ASMSTO_NOOP,
                             0x3000 | (ASM_NOOP << 14)));
 
-            WORD final_opcode =
-                    (z & 0xf) | ((z & 0x10) << 8) | ((y & 0xf) << 4) | ((y &
-                        0x10) << 9) | ((d & 0xf) << 8) | ((operator& 0x1f) <<
-                    14);
-
-            rplCompileAppend(MKOPCODE(LIBRARY_NUMBER + storemode,
-                        final_opcode));
+            rplCompileAppend(ASMMKOPCODE(storemode, operator, d, y, z));
 
             RetNum = OK_CONTINUE;
             return;
@@ -504,6 +504,7 @@ void LIB_HANDLER()
                             if((recurseptr == 0) && ISPACKEDDIR(*value))
                                 recurseptr = direntries - 2;
                         }
+                        rplInvalidateDirIndex(newdir);
 
                     }
                     else
@@ -1717,6 +1718,7 @@ void LIB_HANDLER()
                 firstentry[0] = name;
                 firstentry[1] = val;
                 firstentry += 2;
+                rplInvalidateDirIndex(CurrentDir);
             }
 
             nextname = rplSkipOb(nextname);
@@ -2007,6 +2009,7 @@ void LIB_HANDLER()
                 return;
             }
             val[0] = rplPeekData(1);
+            rplInvalidateIdentCache();
             rplDropData(2);
         }
         else {
@@ -2018,6 +2021,7 @@ void LIB_HANDLER()
                     return;
                 }
                 val[0] = rplPeekData(1);
+                rplInvalidateDirIndex(rplGetDirfromGlobal(val));
                 rplDropData(2);
             }
             else {
@@ -177,14 +177,12 @@ void LIB_HANDLER()
         if(ISUNQUOTEDIDENT(CurOpcode)) {
             // UNQUOTED LAM, NEED TO ALSO DO XEQ ON ITS CONTENTS
             {
-                WORDPTR val = rplGetLAM(rplPeekData(1));
-                if(!val) {
-                    val = rplGetGlobal(rplPeekData(1));
-                    if(!val) {
-                        // INEXISTENT IDENT EVALS TO ITSELF, SO RETURN DIRECTLY
-                        return;
-                    }
+                WORDPTR *var = rplFindIdentCached(rplPeekData(1));
+                if(!var) {
+                    // INEXISTENT IDENT EVALS TO ITSELF, SO RETURN DIRECTLY
+                    return;
                 }
+                WORDPTR val = var[1];
                 rplOverwriteData(1, val);       // REPLACE THE FIRST LEVEL WITH THE VALUE
                 LIBHANDLER han = rplGetLibHandler(LIBNUM(*val));        // AND EVAL THE OBJECT
                 if(han) {
@@ -790,8 +788,10 @@ void LIB_HANDLER()
         }
 
         WORDPTR *var = rplFindLAM((WORDPTR) lam_privatevar_bint, 0);
-        if(var)
+        if(var) {
             *var = (WORDPTR) lam_privatevar_bint + 1;
+            rplInvalidateIdentCache();
+        }
         return;
     }
 
@@ -1917,6 +1917,7 @@ void LIB_HANDLER()
             // JUST OVERWRITE THE UNIT
             found[0] = name;
             found[1] = unit;
+            rplUnitClearCache();
 
             rplDropData(2);
             return;
@@ -1945,6 +1946,7 @@ void LIB_HANDLER()
         if(!unitdir)
             return;     // EXCEPTIONS SHOULD'VE BEEN RAISED ALREADY
         rplCreateGlobalInDir(name, unit, unitdir);
+        rplUnitClearCache();
         rplDropData(2);
         return;
 
@@ -1988,6 +1990,7 @@ void LIB_HANDLER()
         }
 
         rplPurgeForced(found);
+        rplUnitClearCache();
 
         rplDropData(1);
         return;
@@ -255,6 +255,84 @@ BINT rplExpandRuleList()
     return nrules;
 }
 
+// MAXIMUM NUMBER OF DISTINCT OPERATORS TRACKED TO PRE-FILTER RULES
+#define RULE_MAXOPS 32
+
+// CONVERT ALL RULES IN AN EXPANDED RULE LIST TO CANONICAL FORM, IN PLACE
+// SO IT'S DONE ONCE PER COMMAND INSTEAD OF ONCE PER MATCH
+
+static void rplSymbCanonicalRules(WORDPTR * firstrule, BINT nrules)
+{
+    BINT k;
+    WORDPTR newrule;
+
+    for(k = 0; k < nrules; ++k) {
+        if(rplSymbIsRule(firstrule[k])) {
+            // BYPASS THE CACHE, LARGE RULE SETS WOULD ONLY FLUSH IT
+            newrule = rplSymbCanonicalFormNoCache(firstrule[k], 0);
+            if(Exceptions)
+                return;
+            if(newrule && rplSymbIsRule(newrule))
+                firstrule[k] = newrule;
+        }
+    }
+}
+
+// APPLY ALL RULES ONCE, IN SEQUENCE, TO THE EXPRESSION IN LEVEL 1
+// RULES MUST BE IN CANONICAL FORM ALREADY
+// THE OPERATORS OF THE EXPRESSION ARE INDEXED ONCE EACH TIME IT CHANGES, AND
+// RULES USING OPERATORS NOT PRESENT IN THE EXPRESSION ARE NOT TRIED AT ALL
+// RETURN THE TOTAL NUMBER OF REPLACEMENTS
+
+static BINT rplSymbApplyRuleSet(WORDPTR * firstrule, BINT nrules)
+{
+    WORD ops[RULE_MAXOPS];
+    BINT nops = -1, canonical = 0, k;
+    BINT nsolutions, totalreplacements = 0;
+    WORDPTR newexp;
+
+    for(k = 0; k < nrules; ++k) {
+
+        if(!rplSymbIsRule(firstrule[k]))
+            continue;
+
+        if(!canonical) {
+            // THE EXPRESSION CHANGED, CANONICALIZE AND INDEX ITS OPERATORS AGAIN
+            newexp = rplSymbCanonicalForm(rplPeekData(1), 0);
+            if(Exceptions)
+                return totalreplacements;
+            if(newexp) {
+                rplOverwriteData(1, newexp);
+                nops = rplSymbCollectOperators(newexp, ops, RULE_MAXOPS);
+            }
+            else
+                nops = -1;
+            canonical = 1;
+        }
+
+        if((nops >= 0) && !rplSymbRuleCanMatch(firstrule[k], ops, nops))
+            continue;   // SOME OPERATOR IN THE PATTERN IS NOT IN THE EXPRESSION
+
+        rplPushDataNoGrow(firstrule[k]);
+        nsolutions = rplSymbRuleMatchCanonical();
+        if(Exceptions)
+            return totalreplacements;
+        if(nsolutions) {
+            totalreplacements += nsolutions;
+            rplOverwriteData(3, rplPeekData(1));        // REPLACE THE ORIGINAL EXPRESSION WITH THE NEW ONE
+            canonical = 0;
+        }
+        rplDropData(2);
+        // CLEANUP ALL LAM ENVIRONMENTS
+        while(nsolutions > 0) {
+            rplCleanupLAMs(firstrule[k]);
+            --nsolutions;
+        }
+    }
+
+    return totalreplacements;
+}
+
 // IMPLEMENTS THE COMMAND RULEAPPLY, CAN BE CALLED FROM OTHER CAS COMMANDS
 // NEEDS 2 ARGUMENTS ON THE STACK: EXPRESSION AND RULE SET
 
@@ -273,9 +351,15 @@ void rplSymbRuleApply()
     nrules = rplExpandRuleList();
 
     WORDPTR *firstrule = savestk - 1;
-    BINT k;
-    BINT nsolutions, totalreplacements = 0, prevreplacements = -1;
+    BINT totalreplacements = 0, prevreplacements = -1;
     WORD objhash, prevhash;
+
+    rplSymbCanonicalRules(firstrule, nrules);
+    if(Exceptions) {
+        DSTop = savestk;
+        return;
+    }
+
     rplPushDataNoGrow(*(savestk - 2));  // COPY THE EXPRESSION
     prevhash = objhash = 0;
     while(totalreplacements != prevreplacements) {
@@ -285,24 +369,10 @@ void rplSymbRuleApply()
             break;      // SAME OBJECT AFTER 2 ROUNDS OF RULES BEING APPLIED
         prevhash = tmphash;
 
-        for(k = 0; k < nrules; ++k) {
-
-            if(rplSymbIsRule(firstrule[k])) {
-                rplPushDataNoGrow(firstrule[k]);
-                nsolutions = rplSymbRuleMatch();
-                if(Exceptions) {
-                    DSTop = savestk;
-                    return;
-                }
-                totalreplacements += nsolutions;
-                rplOverwriteData(3, rplPeekData(1));    // REPLACE THE ORIGINAL EXPRESSION WITH THE NEW ONE
-                rplDropData(2);
-                // CLEANUP ALL LAM ENVIRONMENTS
-                while(nsolutions > 0) {
-                    rplCleanupLAMs(firstrule[k]);
-                    --nsolutions;
-                }
-            }
+        totalreplacements += rplSymbApplyRuleSet(firstrule, nrules);
+        if(Exceptions) {
+            DSTop = savestk;
+            return;
         }
 
         // WE APPLIED ALL RULES
@@ -334,28 +404,20 @@ void rplSymbRuleApply1()
     nrules = rplExpandRuleList();
 
     WORDPTR *firstrule = savestk - 1;
-    BINT k;
-    BINT nsolutions, totalreplacements = 0;
-    rplPushDataNoGrow(*(savestk - 2));  // COPY THE EXPRESSION
+    BINT totalreplacements;
 
-    for(k = 0; k < nrules; ++k) {
+    rplSymbCanonicalRules(firstrule, nrules);
+    if(Exceptions) {
+        DSTop = savestk;
+        return;
+    }
 
-        if(rplSymbIsRule(firstrule[k])) {
-            rplPushDataNoGrow(firstrule[k]);
-            nsolutions = rplSymbRuleMatch();
-            if(Exceptions) {
-                DSTop = savestk;
-                return;
-            }
-            totalreplacements += nsolutions;
-            rplOverwriteData(3, rplPeekData(1));        // REPLACE THE ORIGINAL EXPRESSION WITH THE NEW ONE
-            rplDropData(2);
-            // CLEANUP ALL LAM ENVIRONMENTS
-            while(nsolutions > 0) {
-                rplCleanupLAMs(firstrule[k]);
-                --nsolutions;
-            }
-        }
+    rplPushDataNoGrow(*(savestk - 2));  // COPY THE EXPRESSION
+
+    totalreplacements = rplSymbApplyRuleSet(firstrule, nrules);
+    if(Exceptions) {
+        DSTop = savestk;
+        return;
     }
 
     // WE APPLIED ALL RULES
@@ -1640,7 +1702,24 @@ void LIB_HANDLER()
         if(!ISSYMBOLIC(*rplPeekData(1)))
             return;     // LEAVE IT ON THE STACK, NOT A SYMBOLIC
 
-        WORD hash = 0, prevhash;
+        WORD hash = 0, prevhash, cachehash = 0;
+        WORDPTR cachedobj;
+        BINT cached = 0;
+
+        if(rplSymbIsCacheable(rplPeekData(1))) {
+            cachedobj =
+                    rplSymbCacheFind(rplPeekData(1), SYMBCACHE_AUTOSIMPLIFY,
+                    &cachehash);
+            if(cachedobj) {
+                rplOverwriteData(1, cachedobj);
+                return;
+            }
+            // KEEP THE ORIGINAL, IT'S THE KEY TO THE CACHE
+            rplPushData(rplPeekData(1));
+            if(Exceptions)
+                return;
+            cached = 1;
+        }
 
         rplSymbAutoSimplify();  // A STAGE OF NUMERIC REDUCTION
         if(Exceptions)
@@ -1805,7 +1884,15 @@ void LIB_HANDLER()
         WORDPTR newobj = rplSymbCanonicalForm(rplPeekData(1), 1);
         if(newobj)
             rplOverwriteData(1, newobj);
+        if(Exceptions)
+            return;
 
+        if(cached) {
+            rplSymbCacheStore(rplPeekData(2), SYMBCACHE_AUTOSIMPLIFY,
+                    cachehash, rplPeekData(1));
+            rplOverwriteData(2, rplPeekData(1));
+            rplDropData(1);
+        }
         return;
 
     }
@@ -260,19 +260,313 @@ BINT rplListItemCompare(WORDPTR a, WORDPTR b)
     rplCallOvrOperator((CMD_OVR_CMP));
     if(Exceptions) {
         // DON'T FAIL IF COMPARISON IS NOT DEFINED, JUST LEAVE THE OBJECTS IN THEIR PLACES
-        if(ErrorCode == ERR_INVALIDOPCODE) {
+        if(ErrorCode == ERR_INVALIDOPCODE)
             rplClearErrors();
-            return -1;
-        }
         return 0;
     }
-    BINT r = rplReadBINT(rplPopData());
+    WORDPTR result = rplPopData();
+    // CMP CAN'T DECIDE (SYMBOLICS), KEEP THE OBJECTS IN THEIR ORIGINAL ORDER
+    if(!ISBINT(*result))
+        return (BINT) (a - b);
+    BINT r = rplReadBINT(result);
     if(r == 0)
         return (BINT) (a - b);
     return r;
 
 }
 
+// SORTING: RUNS SHORTER THAN THIS ARE INSERTION-SORTED BEFORE MERGING
+#define SORT_RUNLENGTH  8
+
+// TYPES OF SORT KEYS FOR HOMOGENEOUS LISTS
+#define SORTKEY_NONE    0
+#define SORTKEY_BINT    1
+#define SORTKEY_REAL    2
+#define SORTKEY_STRING  3
+
+typedef struct
+{
+    BYTEPTR str;
+    BINT len;
+} SORTKEY_STR;
+
+// STABLE MERGE SORT OF n OBJECTS IN THE STACK, STARTING AT base
+// aux MUST POINT TO n/2 MORE STACK LEVELS, SO ALL POINTERS ARE UPDATED
+// IF A COMPARISON TRIGGERS A GC
+
+static void rplListSortObjects(WORDPTR * base, WORDPTR * aux, BINT n)
+{
+    WORDPTR save;
+    BINT start, mid, end, width, i, j, k, r;
+
+    for(start = 0; start < n; start += SORT_RUNLENGTH) {
+        end = (start + SORT_RUNLENGTH < n) ? start + SORT_RUNLENGTH : n;
+        for(i = start + 1; i < end; ++i) {
+            for(j = i; j > start; --j) {
+                r = rplListItemCompare(base[j - 1], base[j]);
+                if(Exceptions)
+                    return;
+                if(r <= 0)
+                    break;
+                save = base[j];
+                base[j] = base[j - 1];
+                base[j - 1] = save;
+            }
+        }
+    }
+
+    for(width = SORT_RUNLENGTH; width < n; width <<= 1) {
+        for(start = 0; start + width < n; start += 2 * width) {
+            mid = start + width;
+            end = (mid + width < n) ? mid + width : n;
+
+            if(mid - start <= end - mid) {
+                // MOVE THE LEFT RUN OUT OF THE WAY, MERGE FORWARD
+                memmovew(aux, base + start,
+                        (mid - start) * sizeof(WORDPTR) / sizeof(WORD));
+                i = 0;
+                j = mid;
+                k = start;
+                while((i < mid - start) && (j < end)) {
+                    r = rplListItemCompare(base[j], aux[i]);
+                    if(Exceptions)
+                        return;
+                    if(r < 0)
+                        base[k++] = base[j++];
+                    else
+                        base[k++] = aux[i++];
+                }
+                while(i < mid - start)
+                    base[k++] = aux[i++];
+            }
+            else {
+                // MOVE THE RIGHT RUN OUT OF THE WAY, MERGE BACKWARDS
+                memmovew(aux, base + mid,
+                        (end - mid) * sizeof(WORDPTR) / sizeof(WORD));
+                i = mid - 1;
+                j = end - mid - 1;
+                k = end - 1;
+                while((i >= start) && (j >= 0)) {
+                    r = rplListItemCompare(aux[j], base[i]);
+                    if(Exceptions)
+                        return;
+                    if(r < 0)
+                        base[k--] = base[i--];
+                    else
+                        base[k--] = aux[j--];
+                }
+                while(j >= 0)
+                    base[k--] = aux[j--];
+            }
+        }
+    }
+}
+
+// DETERMINE IF ALL n OBJECTS CAN BE SORTED BY PRE-DECODED KEYS
+// ALSO RETURN THE NUMBER OF INTEGERS THAT WILL NEED STORAGE AS REALS
+
+static BINT rplListSortKeyType(WORDPTR * base, BINT n, BINT * nbints)
+{
+    BINT k, type;
+    REAL num;
+
+    if(ISSTRING(*base[0])) {
+        for(k = 1; k < n; ++k)
+            if(!ISSTRING(*base[k]))
+                return SORTKEY_NONE;
+        return SORTKEY_STRING;
+    }
+
+    type = SORTKEY_BINT;
+    *nbints = 0;
+    for(k = 0; k < n; ++k) {
+        if(ISBINT(*base[k])) {
+            ++*nbints;
+            continue;
+        }
+        if(!ISREAL(*base[k]))
+            return SORTKEY_NONE;
+        rplReadReal(base[k], &num);
+        if(num.flags & F_NOTANUMBER)
+            return SORTKEY_NONE;
+        type = SORTKEY_REAL;
+    }
+    return type;
+}
+
+// COMPARE KEYS OF OBJECTS i AND j, SAME RESULT AS rplListItemCompare()
+// EQUAL KEYS KEEP THEIR ORIGINAL ORDER
+
+static BINT rplListSortKeyCompare(BINT type, void *keys, WORDPTR * base,
+        BINT i, BINT j)
+{
+    BINT r;
+
+    switch (type) {
+    case SORTKEY_BINT:
+    {
+        BINT64 *k = (BINT64 *) keys;
+        r = (k[i] > k[j]) - (k[i] < k[j]);
+        break;
+    }
+    case SORTKEY_REAL:
+    {
+        REAL *k = (REAL *) keys;
+        // INTEGERS COMPARE EXACTLY AMONG THEMSELVES
+        if(ISBINT(*base[i]) && ISBINT(*base[j])) {
+            BINT64 a = rplReadBINT(base[i]), b = rplReadBINT(base[j]);
+            r = (a > b) - (a < b);
+        }
+        else
+            r = cmpReal(&k[i], &k[j]);
+        break;
+    }
+    case SORTKEY_STRING:
+    {
+        SORTKEY_STR *k = (SORTKEY_STR *) keys;
+        BINT len = (k[i].len < k[j].len) ? k[i].len : k[j].len, c;
+        r = 0;
+        for(c = 0; c < len; ++c) {
+            if(k[i].str[c] != k[j].str[c]) {
+                r = (k[i].str[c] < k[j].str[c]) ? -1 : 1;
+                break;
+            }
+        }
+        if(!r)
+            r = (k[i].len > k[j].len) - (k[i].len < k[j].len);
+        break;
+    }
+    default:
+        r = 0;
+    }
+
+    if(!r)
+        return i - j;
+    return r;
+}
+
+// SORT n OBJECTS IN THE STACK STARTING AT base USING PRE-DECODED KEYS
+// EACH OBJECT IS DECODED ONLY ONCE, AND NO GC CAN HAPPEN WHILE SORTING
+
+static void rplListSortKeys(WORDPTR * base, BINT n, BINT type, BINT nbints)
+{
+    BINT keywords, k, start, mid, end, width, i, j, save;
+    WORDPTR scratch, obj;
+
+    switch (type) {
+    case SORTKEY_BINT:
+        keywords = (n * sizeof(BINT64) + sizeof(WORD) - 1) / sizeof(WORD);
+        break;
+    case SORTKEY_REAL:
+        keywords = (n * sizeof(REAL) + sizeof(WORD) - 1) / sizeof(WORD);
+        keywords += 3 * nbints;
+        break;
+    default:
+        keywords =
+                (n * sizeof(SORTKEY_STR) + sizeof(WORD) - 1) / sizeof(WORD);
+        break;
+    }
+
+    // KEYS ARE 64-BIT ALIGNED, FOLLOWED BY TWO ARRAYS OF INDICES
+    scratch = rplAllocTempOb(keywords + 2 * n + 1);
+    if(!scratch)
+        return;
+
+    void *keys = (void *)((((PTR2NUMBER) scratch) + 7) & ~7);
+    BINT *idx = (BINT *) keys + keywords;
+    BINT *tmp = idx + n, *src, *dest, *swap;
+
+    // DECODE EVERY OBJECT ONCE
+    switch (type) {
+    case SORTKEY_BINT:
+        for(k = 0; k < n; ++k)
+            ((BINT64 *) keys)[k] = rplReadBINT(base[k]);
+        break;
+    case SORTKEY_REAL:
+    {
+        REAL *key = (REAL *) keys;
+        BINT *intdata = (BINT *) (key + n);
+        for(k = 0; k < n; ++k) {
+            if(ISBINT(*base[k])) {
+                key[k].data = intdata;
+                intdata += 3;
+                newRealFromBINT64(&key[k], rplReadBINT(base[k]), 0);
+            }
+            else
+                rplReadReal(base[k], &key[k]);
+        }
+        break;
+    }
+    default:
+    {
+        SORTKEY_STR *key = (SORTKEY_STR *) keys;
+        for(k = 0; k < n; ++k) {
+            key[k].str = (BYTEPTR) (base[k] + 1);
+            key[k].len = rplStrSize(base[k]);
+        }
+        break;
+    }
+    }
+
+    for(k = 0; k < n; ++k)
+        idx[k] = k;
+
+    for(start = 0; start < n; start += SORT_RUNLENGTH) {
+        end = (start + SORT_RUNLENGTH < n) ? start + SORT_RUNLENGTH : n;
+        for(i = start + 1; i < end; ++i) {
+            save = idx[i];
+            for(j = i; (j > start)
+                    && (rplListSortKeyCompare(type, keys, base, idx[j - 1],
+                            save) > 0); --j)
+                idx[j] = idx[j - 1];
+            idx[j] = save;
+        }
+    }
+
+    src = idx;
+    dest = tmp;
+    for(width = SORT_RUNLENGTH; width < n; width <<= 1) {
+        for(start = 0; start < n; start += 2 * width) {
+            mid = (start + width < n) ? start + width : n;
+            end = (start + 2 * width < n) ? start + 2 * width : n;
+            i = start;
+            j = mid;
+            k = start;
+            while((i < mid) && (j < end)) {
+                if(rplListSortKeyCompare(type, keys, base, src[j], src[i]) < 0)
+                    dest[k++] = src[j++];
+                else
+                    dest[k++] = src[i++];
+            }
+            while(i < mid)
+                dest[k++] = src[i++];
+            while(j < end)
+                dest[k++] = src[j++];
+        }
+        swap = src;
+        src = dest;
+        dest = swap;
+    }
+
+    // APPLY THE PERMUTATION TO THE STACK IN PLACE, ONE CYCLE AT A TIME
+    // THE SPARE INDEX ARRAY MARKS THE LEVELS ALREADY DONE
+    for(k = 0; k < n; ++k)
+        dest[k] = 0;
+    for(k = 0; k < n; ++k) {
+        if(dest[k])
+            continue;
+        obj = base[k];
+        for(j = k; src[j] != k; j = src[j]) {
+            base[j] = base[src[j]];
+            dest[j] = 1;
+        }
+        base[j] = obj;
+        dest[j] = 1;
+    }
+
+    rplTruncateLastObject(scratch);
+}
+
 void LIB_HANDLER()
 {
     if(ISPROLOG(CurOpcode)) {
@@ -602,52 +896,33 @@ void LIB_HANDLER()
             return;
         }
 
-        // PERFORM BINARY INSERTION SORT
+        BINT type, nbints = 0;
 
-        WORDPTR *ptr, *ptr2, *endlimit, *startlimit, save;
-        WORDPTR *left, *right;
+        type = rplListSortKeyType(DSTop - nitems - 1, nitems, &nbints);
 
-        startlimit = DSTop - nitems;    // POINT TO SECOND ELEMENT IN THE LIST
-        endlimit = DSTop - 1;   // POINT AFTER THE LAST ELEMENT
-
-        for(ptr = startlimit; ptr < endlimit; ++ptr) {
-            save = *ptr;
-
-            left = startlimit - 1;
-            right = ptr - 1;
-            if(rplListItemCompare(*right, save) > 0) {
-                if(rplListItemCompare(save, *left) > 0) {
-                    while(right - left > 1) {
-                        if(rplListItemCompare(*(left + (right - left) / 2),
-                                    save) > 0) {
-                            right = left + (right - left) / 2;
-                        }
-                        else {
-                            if(Exceptions) {
-                                DSTop = stksave;
-                                return;
-                            }
-                            left = left + (right - left) / 2;
-                        }
-                    }
-                }
-                else {
-                    if(Exceptions) {
-                        DSTop = stksave;
-                        return;
-                    }
-                    right = left;
-                }
-                // INSERT THE POINTER RIGHT BEFORE right
-                for(ptr2 = ptr; ptr2 > right; ptr2 -= 1)
-                    *ptr2 = *(ptr2 - 1);
-                //memmoveb(right+1,right,(ptr-right)*sizeof(WORDPTR));
-                *right = save;
-            }
+        if(type != SORTKEY_NONE)
+            rplListSortKeys(DSTop - nitems - 1, nitems, type, nbints);
+        else {
+            // GENERIC MERGE SORT, THE SCRATCH AREA IS PART OF THE STACK
+            WORDPTR *count;
+            BINT k;
+            rplExpandStack(nitems / 2);
             if(Exceptions) {
                 DSTop = stksave;
                 return;
             }
+            count = DSTop - 1;
+            // COMPARISONS CAN RUN A GC, DON'T LEAVE GARBAGE IN THE NEW LEVELS
+            for(k = 0; k < nitems / 2; ++k)
+                DSTop[k] = (WORDPTR) zero_bint;
+            DSTop += nitems / 2;
+            rplListSortObjects(count - nitems, count + 1, nitems);
+            DSTop = count + 1;
+        }
+
+        if(Exceptions) {
+            DSTop = stksave;
+            return;
         }
 
         rplCreateList();
@@ -569,6 +569,30 @@ void LIB_HANDLER()
             rplError(ERR_INTEGEREXPECTED);
             return;
         }
+
+        if(ISBIGINT(*arg)) {
+            rplError(rplIsNegative(arg) ? ERR_ARGOUTSIDEDOMAIN :
+                    ERR_NUMBERTOOBIG);
+            return;
+        }
+
+        if(ISBINT(*arg) && !ISAPPROX(*arg)) {
+            // EXACT INTEGERS GET AN EXACT RESULT, NOT LIMITED BY THE PRECISION
+            BINT64 n = rplReadBINT(arg);
+            if(n < 0) {
+                rplError(ERR_ARGOUTSIDEDOMAIN);
+                return;
+            }
+            if(n > 0x7fffffff)
+                n = 0x7fffffff;     // STILL TOO BIG, BUT SAFE TO PASS AS A BINT
+            rplNewFactorialPush((BINT) n);
+            if(Exceptions)
+                return;
+            rplOverwriteData(2, rplPeekData(1));
+            rplDropData(1);
+            return;
+        }
+
         REAL rnum;
         rplReadNumberAsReal(arg, &rnum);
         if(Exceptions)
@@ -650,7 +674,10 @@ void LIB_HANDLER()
                 return;
             }
 
-            if(isprimeReal(&num))
+            BINT isprime = isprimeReal(&num);
+            if(Exceptions)
+                return;
+            if(isprime)
                 rplOverwriteData(1, (WORDPTR) one_bint);
             else
                 rplOverwriteData(1, (WORDPTR) zero_bint);
@@ -713,6 +740,8 @@ void LIB_HANDLER()
         }
 
         nextprimeReal(0, &num);
+        if(Exceptions)
+            return;
         rplDropData(1);
         rplNewRealFromRRegPush(0);
 
@@ -802,6 +831,8 @@ void LIB_HANDLER()
             rplZeroToRReg(6);
         do {
             nextprimeReal(5, &RReg[6]);
+            if(Exceptions)
+                return;
             BINT islarger = gtReal(&RReg[5], &num);
             if(islarger) {
                 if(previsprime) {
@@ -1005,6 +1036,38 @@ void LIB_HANDLER()
             return;
         }
 
+        if((OPCODE(CurOpcode) == POWMOD) && !(a2.flags & F_NEGATIVE)
+                && !(m.flags & F_NEGATIVE) && !iszeroReal(&m)) {
+            // EXACT BINARY EXPONENTIATION, NOT LIMITED BY THE PRECISION
+            BIGINT ba, bb, bm, br;
+            BINT done = 0;
+            if(allocBigInt(&ba)) {
+                if(allocBigInt(&bb)) {
+                    if(allocBigInt(&bm)) {
+                        if(allocBigInt(&br)) {
+                            if(newBigIntFromReal(&ba, &a1)
+                                    && newBigIntFromReal(&bb, &a2)
+                                    && newBigIntFromReal(&bm, &m)
+                                    && powmodBigInt(&br, &ba, &bb, &bm)) {
+                                newRealFromBigInt(&RReg[7], &br);
+                                normalize(&RReg[7]);
+                                done = 1;
+                            }
+                            freeBigInt(&br);
+                        }
+                        freeBigInt(&bm);
+                    }
+                    freeBigInt(&bb);
+                }
+                freeBigInt(&ba);
+            }
+            if(done) {
+                rplDropData(2);
+                rplNewRealFromRRegPush(7);
+                return;
+            }
+        }
+
         BINT saveprec = Context.precdigits;
         BINT moddigits = (intdigitsReal(&m) + 7) & ~7;
         BINT numdigits = (intdigitsReal(&a1) + 7) & ~7;
@@ -2124,40 +2187,53 @@ void LIB_HANDLER()
 
         BINT saveprec = Context.precdigits;
 
-        BINT arg1digits = (intdigitsReal(&RReg[1]) + 7) & ~7;
-        BINT arg2digits = (intdigitsReal(&RReg[2]) + 7) & ~7;
-
-        arg1digits *= 2;
-        arg1digits = (arg1digits > arg2digits) ? arg1digits : arg2digits;
-        arg1digits =
-                (arg1digits >
-                Context.precdigits) ? arg1digits : Context.precdigits;
-
-        if(arg1digits > MAX_USERPRECISION) {
-            rplError(ERR_NUMBERTOOBIG);
-            if(cleanup)
-                DSTop = cleanup;
-            return;
-        }
-
-        //   AUTOMATICALLY INCREASE PRECISION TEMPORARILY
-
-        Context.precdigits = arg1digits;
-
         // avoid swapping elements by loop unrolling
         BINT notfinished = 1;
         const BINT q = 0, r1 = 1, r2 = 2, r3 = 3, s1 = 4, s2 = 5, s3 = 6, t1 =
                 7, t2 = 8, t3 = 9;
         BINT igcd, s = 0, t = 0;
         REAL tmp;
-        if(isIEGCD) {
+        tmp.data = 0;
+
+        // EXACT BINARY GCD, NOT LIMITED BY THE PRECISION
+        if(egcdReal(&RReg[r3], isIEGCD ? &RReg[s3] : 0,
+                    isIEGCD ? &RReg[t3] : 0, &RReg[r1], &RReg[r2])) {
+            igcd = r3;
+            s = s3;
+            t = t3;
+            notfinished = 0;
+        }
+
+        if(notfinished || (OPCODE(CurOpcode) == LCM)) {
+            BINT arg1digits = (intdigitsReal(&RReg[1]) + 7) & ~7;
+            BINT arg2digits = (intdigitsReal(&RReg[2]) + 7) & ~7;
+
+            arg1digits *= 2;
+            arg1digits = (arg1digits > arg2digits) ? arg1digits : arg2digits;
+            arg1digits =
+                    (arg1digits >
+                    Context.precdigits) ? arg1digits : Context.precdigits;
+
+            if(arg1digits > MAX_USERPRECISION) {
+                rplError(ERR_NUMBERTOOBIG);
+                if(cleanup)
+                    DSTop = cleanup;
+                return;
+            }
+
+            //   AUTOMATICALLY INCREASE PRECISION TEMPORARILY
+
+            Context.precdigits = arg1digits;
+        }
+
+        if(isIEGCD && notfinished) {
             newRealFromBINT(&RReg[s1], 1, 0);
             newRealFromBINT(&RReg[s2], 0, 0);
             newRealFromBINT(&RReg[t1], 0, 0);
             newRealFromBINT(&RReg[t2], 1, 0);
             tmp.data = allocRegister();
         }
-        do {
+        while(notfinished) {
             if(!iszeroReal(&RReg[r2])) {
                 divmodReal(&RReg[q], &RReg[r3], &RReg[r1], &RReg[r2]);
                 if(isIEGCD) {
@@ -2219,9 +2295,8 @@ void LIB_HANDLER()
                 break;
             }
         }
-        while(notfinished);
 
-        if(isIEGCD) {
+        if(tmp.data) {
             freeRegister(tmp.data);
         }
 
@@ -4797,8 +4872,8 @@ void LIB_HANDLER()
     }
 
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
@@ -61,7 +61,8 @@
     ECMD(USBFWUPDATE,"FWUPD",MKTOKENINFO(5,TITYPE_NOTALLOWED,1,2)), \
     CMD(DOALARM,MKTOKENINFO(7,TITYPE_NOTALLOWED,0,2)), \
     CMD(ALRM,MKTOKENINFO(4,TITYPE_NOTALLOWED,1,2)), \
-    CMD(OFF,MKTOKENINFO(3,TITYPE_NOTALLOWED,1,2))
+    CMD(OFF,MKTOKENINFO(3,TITYPE_NOTALLOWED,1,2)), \
+    CMD(GCPAUSE,MKTOKENINFO(7,TITYPE_NOTALLOWED,0,2))
 
 // ADD MORE OPCODES HERE
 
@@ -2204,6 +2205,15 @@ void LIB_HANDLER()
         //@NEW
         rplGCollect();
         return;
+    case GCPAUSE:
+    {
+        //@SHORT_DESC=Longest garbage collection pause in microseconds
+        //@NEW
+        BINT64 pause = tmr_ticks2us(0, GCMaxPause);
+        GCMaxPause = 0;
+        rplNewBINTPush(pause, DECBINT);
+        return;
+    }
     case MEMCHECK:
     {
         // SYSTEM SANITY CHECK
@@ -2491,8 +2501,8 @@ void LIB_HANDLER()
         return;
     }
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
@@ -327,9 +327,11 @@ void LIB_HANDLER()
         if(Exceptions)
             return;
 
-        trig_sin(&dec, angmode);
+        if(!rplFastNumericUnary(FASTNUM_SIN, &RReg[0], &dec, angmode)) {
+            trig_sin(&dec, angmode);
 
-        finalize(&RReg[0]);
+            finalize(&RReg[0]);
+        }
 
         rplDropData(1);
         rplNewRealFromRRegPush(0);      // SIN
@@ -501,9 +503,11 @@ void LIB_HANDLER()
         if(Exceptions)
             return;
 
-        trig_cos(&dec, angmode);
+        if(!rplFastNumericUnary(FASTNUM_COS, &RReg[0], &dec, angmode)) {
+            trig_cos(&dec, angmode);
 
-        finalize(&RReg[0]);
+            finalize(&RReg[0]);
+        }
         rplDropData(1);
         rplNewRealFromRRegPush(0);      // COS
         return;
@@ -682,8 +686,10 @@ void LIB_HANDLER()
         if(Exceptions)
             return;
 
-        trig_tan(&dec, angmode);
-        finalize(&RReg[0]);
+        if(!rplFastNumericUnary(FASTNUM_TAN, &RReg[0], &dec, angmode)) {
+            trig_tan(&dec, angmode);
+            finalize(&RReg[0]);
+        }
         rplDropData(1);
         rplNewRealFromRRegPush(0);      // TAN
         rplCheckResultAndError(&RReg[0]);
@@ -1554,8 +1560,10 @@ void LIB_HANDLER()
                 rplTestSystemFlag(FL_ANGLEMODE1) |
                 (rplTestSystemFlag(FL_ANGLEMODE2) << 1);
 
-        trig_atan2(&y, &RReg[7], angmode);
-        finalize(&RReg[0]);
+        if(!rplFastNumericUnary(FASTNUM_ATAN, &RReg[0], &y, angmode)) {
+            trig_atan2(&y, &RReg[7], angmode);
+            finalize(&RReg[0]);
+        }
 
         WORDPTR newangle = rplNewAngleFromReal(&RReg[0], angmode);
         if(!newangle)
@@ -1804,8 +1812,10 @@ void LIB_HANDLER()
             return;
         }
 
-        hyp_ln(&x);
-        finalize(&RReg[0]);
+        if(!rplFastNumericUnary(FASTNUM_LN, &RReg[0], &x, ANGLERAD)) {
+            hyp_ln(&x);
+            finalize(&RReg[0]);
+        }
 
         rplDropData(1);
         rplNewRealFromRRegPush(0);
@@ -1996,9 +2006,11 @@ void LIB_HANDLER()
         if(Exceptions)
             return;
 
-        hyp_exp(&dec);
+        if(!rplFastNumericUnary(FASTNUM_EXP, &RReg[0], &dec, ANGLERAD)) {
+            hyp_exp(&dec);
 
-        finalize(&RReg[0]);
+            finalize(&RReg[0]);
+        }
 
         rplDropData(1);
         rplNewRealFromRRegPush(0);      // EXP
@@ -4034,8 +4046,10 @@ void LIB_HANDLER()
 
             x.flags &= ~F_NEGATIVE;
 
-            hyp_sqrt(&x);
-            finalize(&RReg[0]);
+            if(!rplFastNumericUnary(FASTNUM_SQRT, &RReg[0], &x, ANGLERAD)) {
+                hyp_sqrt(&x);
+                finalize(&RReg[0]);
+            }
 
             rplDropData(1);
             if(iscplx) {
@@ -4301,8 +4315,10 @@ void LIB_HANDLER()
             return;
         }
 
-        hyp_log(&x);
-        finalize(&RReg[0]);
+        if(!rplFastNumericUnary(FASTNUM_LOG, &RReg[0], &x, ANGLERAD)) {
+            hyp_log(&x);
+            finalize(&RReg[0]);
+        }
 
         rplDropData(1);
         rplNewRealFromRRegPush(0);
@@ -4462,14 +4478,16 @@ void LIB_HANDLER()
         if(Exceptions)
             return;
 
-        RReg[4].data[0] = 10;
-        RReg[4].exp = 0;
-        RReg[4].len = 1;
-        RReg[4].flags = 0;
+        if(!rplFastNumericUnary(FASTNUM_ALOG, &RReg[0], &dec, ANGLERAD)) {
+            RReg[4].data[0] = 10;
+            RReg[4].exp = 0;
+            RReg[4].len = 1;
+            RReg[4].flags = 0;
 
-        hyp_pow(&RReg[4], &dec);
+            hyp_pow(&RReg[4], &dec);
 
-        finalize(&RReg[0]);
+            finalize(&RReg[0]);
+        }
 
         rplDropData(1);
         rplNewRealFromRRegPush(0);      // EXP
@@ -5027,8 +5045,8 @@ void LIB_HANDLER()
     }
 
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
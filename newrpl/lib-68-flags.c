@@ -287,6 +287,8 @@ const systemflag const flags_names[] = {
     {"DECOMPEDIT", {0x80 | (-FL_DECOMPEDIT), 0, 0, 0, 0, 0, 0, 0}},
     {"CPLX", {0x80 | (-FL_COMPLEXMODE), 0, 0, 0, 0, 0, 0, 0}},
     {"REAL", {(-FL_COMPLEXMODE), 0, 0, 0, 0, 0, 0, 0}},
+    {"FASTNUM", {0x80 | (-FL_FASTNUMERIC), 0, 0, 0, 0, 0, 0, 0}},
+    {"DECNUM", {(-FL_FASTNUMERIC), 0, 0, 0, 0, 0, 0, 0}},
 
 // TODO: ADD MORE FLAG NAMES HERE
     {NULL, {0, 0, 0, 0, 0, 0, 0, 0}}
@@ -525,6 +527,34 @@ BINT rplTestSystemFlag(BINT flag)
 
 }
 
+// BIT MASK OF A SYSTEM FLAG WITHIN WORD n OF THE FLAGS
+#define FLAGBIT(flag, n) \
+    ((((-(flag) - 1) >> 5) == (n)) ? (1U << ((-(flag) - 1) & 31)) : 0)
+
+// STATUS FLAGS CHANGE DURING ANY COMPUTATION BUT DON'T CHANGE HOW OBJECTS ARE PROCESSED
+#define STATUSFLAGS(n) (FLAGBIT(FL_NEGUNDERFLOW, n) \
+    | FLAGBIT(FL_POSUNDERFLOW, n) | FLAGBIT(FL_OVERFLOW, n) \
+    | FLAGBIT(FL_INFINITE, n) | FLAGBIT(FL_LISTCMDCLEANUP, n) \
+    | FLAGBIT(FL_FORCED_RAD, n) | FLAGBIT(FL_ASMZERO, n) \
+    | FLAGBIT(FL_ASMNEG, n))
+
+static const WORD status_flags[4] = {
+    STATUSFLAGS(0), STATUSFLAGS(1), STATUSFLAGS(2), STATUSFLAGS(3)
+};
+
+// COPY THE 4 WORDS OF SYSTEM FLAGS WITHOUT THE STATUS FLAGS
+// USED BY CACHES TO DETECT A CHANGE IN THE SETTINGS
+// ALL WORDS ARE ZERO IF SYSTEM FLAGS ARE CORRUPTED OR INVALID
+
+void rplGetSystemFlagsSettings(WORD * settings)
+{
+    BINT k;
+    WORDPTR flags = ISBINDATA(*SystemFlags) ? SystemFlags + 1 : 0;
+
+    for(k = 0; k < 4; ++k)
+        settings[k] = flags ? (flags[k] & ~status_flags[k]) : 0;
+}
+
 // RETURN 0/1 IF THE MULTIPLE FLAGS MATCH THE SETTINGS
 // RETURN -1 IF THE NAME IS NOT VALID
 // RETURN -2 IF SYSTEM FLAGS ARE CORRUPTED OR INVALID
@@ -3447,8 +3477,8 @@ void LIB_HANDLER()
     }
 
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
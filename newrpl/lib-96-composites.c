@@ -199,6 +199,21 @@ void LIB_HANDLER()
             // listelem = LAST LIST
 
             WORDPTR newobj = rplPeekData(1);    // OBJECT TO REPLACE
+
+            // A LIST ONLY REFERENCED BY THE VARIABLE CAN BE MODIFIED IN PLACE
+            if(var && (ndims == 1) && (comp == *(var + 1))
+                    && !ISLIST(*rplPeekData(2))) {
+                position = rplReadNumberAsBINT(rplPeekData(2));
+                if(Exceptions) {
+                    rplError(ERR_INVALIDPOSITION);
+                    return;
+                }
+                if(rplListReplaceInPlace(var + 1, position, newobj)) {
+                    newobj = comp;
+                    k = 0;      // NOTHING ELSE TO REPLACE
+                }
+            }
+
             ScratchPointer3 = comp;
 
             for(; k >= 1; --k) {
@@ -481,6 +496,21 @@ void LIB_HANDLER()
             // listelem = LAST LIST
 
             WORDPTR newobj = rplPeekData(1);    // OBJECT TO REPLACE
+
+            // A LIST ONLY REFERENCED BY THE VARIABLE CAN BE MODIFIED IN PLACE
+            if(var && (ndims == 1) && (comp == *(var + 1))
+                    && !ISLIST(*rplPeekData(2))) {
+                position = rplReadNumberAsBINT(rplPeekData(2));
+                if(Exceptions) {
+                    rplError(ERR_INVALIDPOSITION);
+                    return;
+                }
+                if(rplListReplaceInPlace(var + 1, position, newobj)) {
+                    newobj = comp;
+                    k = 0;      // NOTHING ELSE TO REPLACE
+                }
+            }
+
             ScratchPointer3 = comp;
 
             for(; k >= 1; --k) {
@@ -2940,8 +2970,8 @@ void LIB_HANDLER()
     }
 
     case OPCODE_LIBINSTALL:
-        LibraryList = (WORDPTR) libnumberlist;
-        RetNum = OK_CONTINUE;
+        libInstallCmds(libnumberlist, (char **)LIB_NAMES,
+                LIB_NUMBEROFCMDS);
         return;
     case OPCODE_LIBREMOVE:
         return;
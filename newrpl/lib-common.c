@@ -19,6 +19,9 @@ void libCompileCmds(BINT libnum, char *libnames[], WORD libopcodes[],
     int idx;
     int len;
     for(idx = 0; idx < numcmds; ++idx) {
+        // QUICK REJECT BEFORE MEASURING THE NAME
+        if(*libnames[idx] != *((char *)TokenStart))
+            continue;
         len = utf8len((char *)libnames[idx]);
         if((len != 0) && (len == (BINT) TokenLen)
                 && (!utf8ncmp2((char *)TokenStart, (char *)BlankStart,
@@ -34,6 +37,19 @@ void libCompileCmds(BINT libnum, char *libnames[], WORD libopcodes[],
     RetNum = ERR_NOTMINE;
 }
 
+// STANDARD INSTALLATION FOR LIBRARIES THAT DEFINE ONLY COMMANDS
+// REPORTS THE COMMAND NAMES SO THE COMPILER CAN INDEX THEM
+// ONLY FOR LIBRARIES WHERE OPCODE_COMPILE USES libCompileCmds() AND
+// NEVER ACCEPTS A TOKEN THAT IS NOT ONE OF ITS COMMAND NAMES
+void libInstallCmds(const HALFWORD libnumbers[], char *libnames[],
+        int numcmds)
+{
+    LibraryList = (WORDPTR) libnumbers;
+    LibraryCmdNames = (WORDPTR) libnames;
+    LibraryNumCmds = numcmds;
+    RetNum = OK_CONTINUE;
+}
+
 // STANDARD DECOMPILER FOR COMMAND TOKENS
 // COMMON TO ALL LIBRARIES THAT DEFINE ONLY COMMANDS
 
@@ -393,7 +393,8 @@ void LIB_HANDLER()
         switch (OPCODE(CurOpcode)) {
         case OVR_ADD:
             // ADD TWO BINTS FROM THE STACK
-            addReal(&RReg[0], &Darg1, &Darg2);
+            if(!rplFastNumericBinary(FASTNUM_ADD, &RReg[0], &Darg1, &Darg2))
+                addReal(&RReg[0], &Darg1, &Darg2);
             rplNewRealFromRRegPush(0);
             if(!Exceptions)
                 rplCheckResultAndError(&RReg[0]);
@@ -401,7 +402,8 @@ void LIB_HANDLER()
             return;
 
         case OVR_SUB:
-            subReal(&RReg[0], &Darg1, &Darg2);
+            if(!rplFastNumericBinary(FASTNUM_SUB, &RReg[0], &Darg1, &Darg2))
+                subReal(&RReg[0], &Darg1, &Darg2);
             rplNewRealFromRRegPush(0);
             if(!Exceptions)
                 rplCheckResultAndError(&RReg[0]);
@@ -409,7 +411,8 @@ void LIB_HANDLER()
             return;
 
         case OVR_MUL:
-            mulReal(&RReg[0], &Darg1, &Darg2);
+            if(!rplFastNumericBinary(FASTNUM_MUL, &RReg[0], &Darg1, &Darg2))
+                mulReal(&RReg[0], &Darg1, &Darg2);
             rplNewRealFromRRegPush(0);
             if(!Exceptions)
                 rplCheckResultAndError(&RReg[0]);
@@ -417,7 +420,8 @@ void LIB_HANDLER()
             return;
 
         case OVR_DIV:
-            divReal(&RReg[0], &Darg1, &Darg2);
+            if(!rplFastNumericBinary(FASTNUM_DIV, &RReg[0], &Darg1, &Darg2))
+                divReal(&RReg[0], &Darg1, &Darg2);
             if(rplTestSystemFlag(FL_COMPLEXMODE)) {
                 if(iszeroReal(&Darg2) && !iszeroReal(&Darg1))
                     RReg[0].flags |= F_UNDINFINITY;
@@ -5,7 +5,7 @@
  * See the file LICENSE.txt that shipped with this distribution.
  */
 
-// LIBRARY ONE DEFINES THE BASIC TYPES BINT AND SINT
+// LIBRARY ONE DEFINES THE BASIC TYPES BINT AND SINT, AND BIGINT FOR LARGER INTEGERS
 
 #include "libraries.h"
 
@@ -44,7 +44,8 @@
 #define LIBRARY_ASSIGNED_NUMBERS \
             DECBINT,BINBINT,OCTBINT,HEXBINT, \
             DECBINT|APPROX_BIT,BINBINT|APPROX_BIT, \
-            OCTBINT|APPROX_BIT,HEXBINT|APPROX_BIT
+            OCTBINT|APPROX_BIT,HEXBINT|APPROX_BIT, \
+            DOBIGINT
 
 // THIS HEADER DEFINES MANY COMMON MACROS FOR ALL LIBRARIES
 #include "lib-header.h"
@@ -357,6 +358,11 @@ BINT rplIsNegative(WORDPTR objptr)
             return 1;
         return 0;
     }
+    if(ISBIGINT(*objptr)) {
+        if(objptr[1] & F_NEGATIVE)
+            return 1;
+        return 0;
+    }
     if(ISREAL(*objptr)) {
         REAL dec;
         rplReadReal(objptr, &dec);
@@ -386,6 +392,11 @@ void rplNumberToRReg(int num, WORDPTR number)
         rplCopyRealToRReg(num, number);
     else if(ISBINT(*number))
         rplBINTToRReg(num, rplReadBINT(number));
+    else if(ISBIGINT(*number)) {
+        REAL dec;
+        rplLoadBigIntAsReal(number, &dec);
+        copyReal(&RReg[num], &dec);
+    }
     else {
         rplError(ERR_REALEXPECTED);
     }
@@ -415,6 +426,11 @@ BINT64 rplReadNumberAsBINT(WORDPTR number)
     }
     else if(ISBINT(*number))
         return rplReadBINT(number);
+    else if(ISBIGINT(*number)) {
+        // BIGINTS ARE ALWAYS OUTSIDE THE 64-BIT RANGE
+        rplError(ERR_NUMBERTOOBIG);
+        return 0;
+    }
     else {
         if(ISTAG(*number)) {
             number = rplStripTag(number);
@@ -451,6 +467,8 @@ void rplReadNumberAsReal(WORDPTR number, REAL * dec)
         if(BINT2RealIdx >= BINT2REAL)
             BINT2RealIdx = 0;
     }
+    else if(ISBIGINT(*number))
+        rplLoadBigIntAsReal(number, dec);
     else {
         if(ISTAG(*number)) {
             number = rplStripTag(number);
@@ -587,6 +605,1217 @@ BINT rplIntToString(BINT64 number, BINT base, BYTEPTR buffer, BYTEPTR endbuffer)
 
 }
 
+// *************************************************************************
+// BIG INTEGER KERNEL: ARBITRARY PRECISION BINARY INTEGERS FOR EXACT WORK
+// NUMBERS ARE CONVERTED FROM/TO REALS ONLY AT THE BOUNDARIES
+// *************************************************************************
+
+// PROVIDE STORAGE FOR A BIG INTEGER, RETURN 0 IF NO REGISTERS ARE AVAILABLE
+BINT allocBigInt(BIGINT * a)
+{
+    a->data = (WORD *) allocRegister();
+    a->len = 0;
+    a->maxlen = BIGINT_MAXWORDS;
+    a->flags = 0;
+    return a->data != 0;
+}
+
+void freeBigInt(BIGINT * a)
+{
+    freeRegister((BINT *) a->data);
+}
+
+// REMOVE LEADING ZERO WORDS, ZERO IS ALWAYS POSITIVE
+static void bigint_trim(BIGINT * a)
+{
+    while(a->len && !a->data[a->len - 1])
+        --a->len;
+    if(!a->len)
+        a->flags = 0;
+}
+
+void copyBigInt(BIGINT * dest, BIGINT * src)
+{
+    BINT k;
+    if(dest == src)
+        return;
+    for(k = 0; k < src->len; ++k)
+        dest->data[k] = src->data[k];
+    dest->len = src->len;
+    dest->flags = src->flags;
+}
+
+// EXCHANGE THE STORAGE OF 2 NUMBERS, NO DATA IS COPIED
+void swapBigInt(BIGINT * a, BIGINT * b)
+{
+    BIGINT tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+void newBigIntFromBINT64(BIGINT * result, BINT64 value)
+{
+    UBINT64 mag = (value < 0) ? -(UBINT64) value : (UBINT64) value;
+    result->flags = (value < 0) ? F_NEGATIVE : 0;
+    result->data[0] = (WORD) mag;
+    result->data[1] = (WORD) (mag >> 32);
+    result->len = 2;
+    bigint_trim(result);
+}
+
+// a=a*m+add, RETURN 0 ON OVERFLOW
+static BINT bigint_mulsmall(BIGINT * a, WORD m, WORD add)
+{
+    UBINT64 carry = add, t;
+    BINT k;
+
+    for(k = 0; k < a->len; ++k) {
+        t = (UBINT64) a->data[k] * m + carry;
+        a->data[k] = (WORD) t;
+        carry = t >> 32;
+    }
+    if(carry) {
+        if(a->len >= a->maxlen)
+            return 0;
+        a->data[a->len++] = (WORD) carry;
+    }
+    return 1;
+}
+
+// a=a/d, RETURN THE REMAINDER
+static WORD bigint_divsmall(BIGINT * a, WORD d)
+{
+    UBINT64 rem = 0;
+    BINT k;
+
+    for(k = a->len - 1; k >= 0; --k) {
+        rem = (rem << 32) | a->data[k];
+        a->data[k] = (WORD) (rem / d);
+        rem %= d;
+    }
+    bigint_trim(a);
+    return (WORD) rem;
+}
+
+// CONVERT AN INTEGER REAL TO BINARY
+// RETURN 0 IF THE NUMBER IS NOT AN INTEGER OR IT'S TOO LARGE
+
+BINT newBigIntFromReal(BIGINT * result, REAL * number)
+{
+    BINT k, first = 0, div = 1, exp;
+
+    result->len = 0;
+    result->flags = 0;
+
+    if(!isintegerReal(number))
+        return 0;
+    if(iszeroReal(number))
+        return 1;
+    // 9 DECIMAL DIGITS ALWAYS FIT IN A 32-BIT WORD
+    if(intdigitsReal(number) > (result->maxlen - 1) * 9)
+        return 0;
+
+    if(number->exp < 0) {
+        // SKIP THE TRAILING ZEROS OF THE INTEGER
+        first = (-number->exp) >> 3;
+        for(k = (-number->exp) & 7; k > 0; --k)
+            div *= 10;
+    }
+
+    for(k = number->len - 1; k > first; --k)
+        bigint_mulsmall(result, 100000000, number->data[k]);
+    bigint_mulsmall(result, 100000000 / div, number->data[first] / div);
+
+    for(exp = number->exp; exp >= 8; exp -= 8)
+        bigint_mulsmall(result, 100000000, 0);
+    if(exp > 0) {
+        for(div = 1; exp > 0; --exp)
+            div *= 10;
+        bigint_mulsmall(result, div, 0);
+    }
+
+    result->flags = number->flags & F_NEGATIVE;
+    return 1;
+}
+
+// CONVERT A BIG INTEGER TO A REAL, a IS DESTROYED
+// result MUST HAVE A FULL REGISTER OF STORAGE
+
+void newRealFromBigInt(REAL * result, BIGINT * a)
+{
+    BINT k = 0;
+
+    result->flags = a->flags & F_NEGATIVE;
+    result->exp = 0;
+    while(a->len)
+        result->data[k++] = bigint_divsmall(a, 100000000);
+    if(!k) {
+        result->data[0] = 0;
+        result->flags = 0;
+        k = 1;
+    }
+    result->len = k;
+}
+
+// COMPARE MAGNITUDES, RETURN -1, 0 OR 1
+static BINT bigint_cmpmag(BIGINT * a, BIGINT * b)
+{
+    BINT k;
+
+    if(a->len != b->len)
+        return (a->len > b->len) ? 1 : -1;
+    for(k = a->len - 1; k >= 0; --k) {
+        if(a->data[k] != b->data[k])
+            return (a->data[k] > b->data[k]) ? 1 : -1;
+    }
+    return 0;
+}
+
+// COMPARE 2 SIGNED NUMBERS, RETURN -1, 0 OR 1
+BINT cmpBigInt(BIGINT * a, BIGINT * b)
+{
+    BINT sign = (a->flags & F_NEGATIVE) ? -1 : 1;
+
+    if((a->flags ^ b->flags) & F_NEGATIVE)
+        return sign;
+    return sign * bigint_cmpmag(a, b);
+}
+
+// |result|=|a|+|b|, ANY ARGUMENTS CAN BE THE SAME
+static BINT bigint_addmag(BIGINT * result, BIGINT * a, BIGINT * b)
+{
+    BINT k;
+    UBINT64 carry = 0;
+
+    if(a->len < b->len) {
+        BIGINT *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    for(k = 0; k < b->len; ++k) {
+        carry += (UBINT64) a->data[k] + b->data[k];
+        result->data[k] = (WORD) carry;
+        carry >>= 32;
+    }
+    for(; k < a->len; ++k) {
+        carry += a->data[k];
+        result->data[k] = (WORD) carry;
+        carry >>= 32;
+    }
+    result->len = a->len;
+    if(carry) {
+        if(result->len >= result->maxlen)
+            return 0;
+        result->data[result->len++] = (WORD) carry;
+    }
+    return 1;
+}
+
+// |result|=|a|-|b|, WITH |a|>=|b|, ANY ARGUMENTS CAN BE THE SAME
+static void bigint_submag(BIGINT * result, BIGINT * a, BIGINT * b)
+{
+    BINT k;
+    BINT64 borrow = 0;
+
+    for(k = 0; k < b->len; ++k) {
+        borrow += (BINT64) a->data[k] - b->data[k];
+        result->data[k] = (WORD) borrow;
+        borrow >>= 32;
+    }
+    for(; k < a->len; ++k) {
+        borrow += a->data[k];
+        result->data[k] = (WORD) borrow;
+        borrow >>= 32;
+    }
+    result->len = a->len;
+    bigint_trim(result);
+}
+
+// SIGNED ADDITION OF a AND b, WITH THE SIGN OF b GIVEN SEPARATELY
+static BINT bigint_addsigned(BIGINT * result, BIGINT * a, BIGINT * b,
+        BINT bsign)
+{
+    BINT asign = a->flags & F_NEGATIVE;
+
+    if(asign == bsign) {
+        if(!bigint_addmag(result, a, b))
+            return 0;
+        result->flags = asign;
+    }
+    else if(bigint_cmpmag(a, b) >= 0) {
+        bigint_submag(result, a, b);
+        result->flags = asign;
+    }
+    else {
+        bigint_submag(result, b, a);
+        result->flags = bsign;
+    }
+    bigint_trim(result);
+    return 1;
+}
+
+// result=a+b, ANY ARGUMENTS CAN BE THE SAME, RETURN 0 ON OVERFLOW
+BINT addBigInt(BIGINT * result, BIGINT * a, BIGINT * b)
+{
+    return bigint_addsigned(result, a, b, b->flags & F_NEGATIVE);
+}
+
+// result=a-b, ANY ARGUMENTS CAN BE THE SAME, RETURN 0 ON OVERFLOW
+BINT subBigInt(BIGINT * result, BIGINT * a, BIGINT * b)
+{
+    BINT bsign = b->len ? (b->flags & F_NEGATIVE) ^ F_NEGATIVE : 0;
+    return bigint_addsigned(result, a, b, bsign);
+}
+
+// r=a*b, r HAS la+lb WORDS AND CAN'T OVERLAP a OR b
+static void bigint_mulbasic(WORD * r, WORD * a, BINT la, WORD * b, BINT lb)
+{
+    BINT i, j;
+    UBINT64 carry;
+    WORD ai;
+
+    for(i = 0; i < la + lb; ++i)
+        r[i] = 0;
+
+    for(i = 0; i < la; ++i) {
+        ai = a[i];
+        if(!ai)
+            continue;
+        carry = 0;
+        for(j = 0; j < lb; ++j) {
+            carry += (UBINT64) ai * b[j] + r[i + j];
+            r[i + j] = (WORD) carry;
+            carry >>= 32;
+        }
+        r[i + j] = (WORD) carry;
+    }
+}
+
+// r+=b, THE CARRY PROPAGATES UP TO lr WORDS AND IS DROPPED BEYOND THAT
+static void bigint_addto(WORD * r, BINT lr, WORD * b, BINT lb)
+{
+    UBINT64 carry = 0;
+    BINT k;
+
+    for(k = 0; k < lb; ++k) {
+        carry += (UBINT64) r[k] + b[k];
+        r[k] = (WORD) carry;
+        carry >>= 32;
+    }
+    for(; carry && (k < lr); ++k) {
+        carry += r[k];
+        r[k] = (WORD) carry;
+        carry >>= 32;
+    }
+}
+
+// r-=b, WITH r>=b AND lr>=lb
+static void bigint_subfrom(WORD * r, BINT lr, WORD * b, BINT lb)
+{
+    BINT64 borrow = 0;
+    BINT k;
+
+    for(k = 0; k < lb; ++k) {
+        borrow += (BINT64) r[k] - b[k];
+        r[k] = (WORD) borrow;
+        borrow >>= 32;
+    }
+    for(; borrow && (k < lr); ++k) {
+        borrow += r[k];
+        r[k] = (WORD) borrow;
+        borrow >>= 32;
+    }
+}
+
+// OPERANDS SHORTER THAN THIS USE THE SCHOOLBOOK PRODUCT
+#define BIGINT_KARATSUBA_MIN 32
+
+// WORDS OF SCRATCH NEEDED BY bigint_karatsuba() WITH n-WORD OPERANDS
+static BINT bigint_kscratch(BINT n)
+{
+    BINT h = n - (n >> 1);
+
+    if(n < BIGINT_KARATSUBA_MIN)
+        return 0;
+    return 4 * h + 4 + bigint_kscratch(h + 1);
+}
+
+// r=a*b WITH n-WORD OPERANDS, r HAS 2*n WORDS
+// t IS SCRATCH STORAGE OF bigint_kscratch(n) WORDS, NOTHING CAN OVERLAP
+
+static void bigint_karatsuba(WORD * r, WORD * a, WORD * b, BINT n, WORD * t)
+{
+    BINT m = n >> 1, h = n - m, k;
+    WORD *sa = t, *sb = t + h + 1, *z1 = t + 2 * h + 2;
+
+    if(n < BIGINT_KARATSUBA_MIN) {
+        bigint_mulbasic(r, a, n, b, n);
+        return;
+    }
+
+    // LOW AND HIGH PRODUCTS GO STRAIGHT INTO THE RESULT
+    bigint_karatsuba(r, a, b, m, t);
+    bigint_karatsuba(r + 2 * m, a + m, b + m, h, t);
+
+    // MIDDLE TERM (a0+a1)*(b0+b1)-a0*b0-a1*b1
+    for(k = 0; k < h; ++k) {
+        sa[k] = a[m + k];
+        sb[k] = b[m + k];
+    }
+    sa[h] = sb[h] = 0;
+    bigint_addto(sa, h + 1, a, m);
+    bigint_addto(sb, h + 1, b, m);
+    bigint_karatsuba(z1, sa, sb, h + 1, t + 4 * h + 4);
+    bigint_subfrom(z1, 2 * h + 2, r, 2 * m);
+    bigint_subfrom(z1, 2 * h + 2, r + 2 * m, 2 * h);
+    bigint_addto(r + m, m + 2 * h, z1, 2 * h + 2);
+}
+
+// WORDS OF SCRATCH NEEDED BY bigint_mulwords()
+static BINT bigint_mulscratch(BINT la, BINT lb)
+{
+    BINT n = (la < lb) ? la : lb;
+
+    if(n < BIGINT_KARATSUBA_MIN)
+        return 0;
+    return 3 * n + bigint_kscratch(n);
+}
+
+// r=a*b, r HAS la+lb WORDS, t IS SCRATCH OF bigint_mulscratch(la,lb) WORDS
+// THE LONGER OPERAND IS MULTIPLIED IN SLICES AS LONG AS THE SHORTER ONE
+// NOTHING CAN OVERLAP
+
+static void bigint_mulwords(WORD * r, WORD * a, BINT la, WORD * b, BINT lb,
+        WORD * t)
+{
+    BINT off, k, n;
+    WORD *slice, *prod;
+
+    if(la < lb) {
+        slice = a;
+        a = b;
+        b = slice;
+        k = la;
+        la = lb;
+        lb = k;
+    }
+    if(lb < BIGINT_KARATSUBA_MIN) {
+        bigint_mulbasic(r, a, la, b, lb);
+        return;
+    }
+    prod = t + lb;
+
+    for(k = 0; k < la + lb; ++k)
+        r[k] = 0;
+
+    for(off = 0; off < la; off += lb) {
+        n = la - off;
+        if(n >= lb)
+            slice = a + off;
+        else {
+            // PAD THE LAST SLICE WITH ZEROS
+            slice = t;
+            for(k = 0; k < n; ++k)
+                slice[k] = a[off + k];
+            for(; k < lb; ++k)
+                slice[k] = 0;
+        }
+        bigint_karatsuba(prod, slice, b, lb, prod + 2 * lb);
+        n = la + lb - off;
+        bigint_addto(r + off, n, prod, (n < 2 * lb) ? n : 2 * lb);
+    }
+}
+
+// result=a*b, result CAN'T BE a OR b, RETURN 0 ON OVERFLOW
+BINT mulBigInt(BIGINT * result, BIGINT * a, BIGINT * b)
+{
+    if(a->len + b->len > result->maxlen)
+        return 0;
+
+    bigint_mulbasic(result->data, a->data, a->len, b->data, b->len);
+    result->len = a->len + b->len;
+    result->flags = (a->flags ^ b->flags) & F_NEGATIVE;
+    bigint_trim(result);
+    return 1;
+}
+
+// COUNT LEADING ZERO BITS OF A NON-ZERO WORD
+static BINT bigint_clz(WORD w)
+{
+    BINT n = 0;
+    if(!(w & 0xffff0000)) {
+        n += 16;
+        w <<= 16;
+    }
+    if(!(w & 0xff000000)) {
+        n += 8;
+        w <<= 8;
+    }
+    if(!(w & 0xf0000000)) {
+        n += 4;
+        w <<= 4;
+    }
+    if(!(w & 0xc0000000)) {
+        n += 2;
+        w <<= 2;
+    }
+    if(!(w & 0x80000000))
+        ++n;
+    return n;
+}
+
+// SHIFT THE FIRST len WORDS OF data LEFT (shift>0) BY shift BITS
+// THE BITS SHIFTED OUT ARE RETURNED
+static WORD bigint_shl(WORD * data, BINT len, BINT shift)
+{
+    WORD out = 0, w;
+    BINT k;
+
+    if(!shift)
+        return 0;
+    for(k = 0; k < len; ++k) {
+        w = data[k];
+        data[k] = (w << shift) | out;
+        out = w >> (32 - shift);
+    }
+    return out;
+}
+
+static void bigint_shr(WORD * data, BINT len, BINT shift)
+{
+    BINT k;
+
+    if(!shift)
+        return;
+    for(k = 0; k < len - 1; ++k)
+        data[k] = (data[k] >> shift) | (data[k + 1] << (32 - shift));
+    data[len - 1] >>= shift;
+}
+
+// INTEGER DIVISION (KNUTH'S ALGORITHM D), TRUNCATED TOWARDS ZERO
+// a IS REPLACED WITH THE REMAINDER, WHICH KEEPS THE SIGN OF a
+// quotient IS OPTIONAL (NULL), CAN'T BE a OR b
+// b IS TEMPORARILY SHIFTED BUT ALWAYS RESTORED
+// RETURN 0 ON DIVISION BY ZERO
+
+BINT divmodBigInt(BIGINT * quotient, BIGINT * a, BIGINT * b)
+{
+    BINT n = b->len, m = a->len, i, j, shift;
+    BINT qsign = (a->flags ^ b->flags) & F_NEGATIVE;
+    UBINT64 p, qhat, rhat;
+    BINT64 t, k;
+    WORD *u = a->data, *v = b->data;
+
+    if(!n)
+        return 0;
+
+    if(bigint_cmpmag(a, b) < 0) {
+        if(quotient) {
+            quotient->len = 0;
+            quotient->flags = 0;
+        }
+        return 1;
+    }
+
+    if(n == 1) {
+        WORD rem;
+        if(quotient) {
+            copyBigInt(quotient, a);
+            rem = bigint_divsmall(quotient, v[0]);
+            quotient->flags = qsign;
+            bigint_trim(quotient);
+        }
+        else {
+            rem = 0;
+            for(j = m - 1; j >= 0; --j)
+                rem = (WORD) ((((UBINT64) rem << 32) | u[j]) % v[0]);
+        }
+        u[0] = rem;
+        a->len = 1;
+        bigint_trim(a);
+        return 1;
+    }
+
+    // NORMALIZE SO THE DIVISOR HAS ITS MOST SIGNIFICANT BIT SET
+    shift = bigint_clz(v[n - 1]);
+    bigint_shl(v, n, shift);
+    u[m] = bigint_shl(u, m, shift);
+
+    for(j = m - n; j >= 0; --j) {
+        // ESTIMATE THE NEXT QUOTIENT WORD
+        p = ((UBINT64) u[j + n] << 32) | u[j + n - 1];
+        qhat = p / v[n - 1];
+        rhat = p - qhat * v[n - 1];
+        while((qhat >> 32)
+                || (qhat * v[n - 2] > ((rhat << 32) | u[j + n - 2]))) {
+            --qhat;
+            rhat += v[n - 1];
+            if(rhat >> 32)
+                break;
+        }
+
+        // MULTIPLY AND SUBTRACT
+        k = 0;
+        for(i = 0; i < n; ++i) {
+            p = qhat * v[i];
+            t = (BINT64) u[i + j] - k - (BINT64) (p & 0xffffffff);
+            u[i + j] = (WORD) t;
+            k = (BINT64) (p >> 32) - (t >> 32);
+        }
+        t = (BINT64) u[j + n] - k;
+        u[j + n] = (WORD) t;
+
+        if(t < 0) {
+            // ESTIMATE WAS ONE TOO LARGE, ADD BACK
+            --qhat;
+            p = 0;
+            for(i = 0; i < n; ++i) {
+                p += (UBINT64) u[i + j] + v[i];
+                u[i + j] = (WORD) p;
+                p >>= 32;
+            }
+            u[j + n] += (WORD) p;
+        }
+        if(quotient)
+            quotient->data[j] = (WORD) qhat;
+    }
+
+    if(quotient) {
+        quotient->len = m - n + 1;
+        quotient->flags = qsign;
+        bigint_trim(quotient);
+    }
+
+    // UNNORMALIZE THE REMAINDER AND THE DIVISOR
+    bigint_shr(u, n, shift);
+    bigint_shr(v, n, shift);
+    a->len = n;
+    bigint_trim(a);
+    return 1;
+}
+
+// result=(a*b) MOD mod, result CAN BE a OR b, tmp IS SCRATCH STORAGE
+BINT mulmodBigInt(BIGINT * result, BIGINT * a, BIGINT * b, BIGINT * mod,
+        BIGINT * tmp)
+{
+    if(!mulBigInt(tmp, a, b))
+        return 0;
+    divmodBigInt(0, tmp, mod);
+    copyBigInt(result, tmp);
+    return 1;
+}
+
+// result=a^b MOD mod FOR b>=0 AND mod>0, THE RESULT IS ALWAYS POSITIVE
+// a IS REDUCED IN PLACE, result CAN'T BE ANY OF THE ARGUMENTS
+// RETURN 0 IF THERE'S NO STORAGE FOR THE TEMPORARY PRODUCTS
+
+BINT powmodBigInt(BIGINT * result, BIGINT * a, BIGINT * b, BIGINT * mod)
+{
+    BIGINT tmp;
+    BINT k, bit;
+
+    if(2 * mod->len > BIGINT_MAXWORDS)
+        return 0;
+    if(!allocBigInt(&tmp))
+        return 0;
+
+    divmodBigInt(0, a, mod);
+    if(a->flags & F_NEGATIVE)
+        bigint_addsigned(a, a, mod, 0);
+
+    newBigIntFromBINT64(result, 1);
+    divmodBigInt(0, result, mod);
+
+    // LEFT TO RIGHT BINARY EXPONENTIATION
+    for(k = b->len - 1; k >= 0; --k) {
+        for(bit = 31; bit >= 0; --bit) {
+            if(result->len > 1 || (result->len && result->data[0] != 1))
+                mulmodBigInt(result, result, result, mod, &tmp);
+            if((b->data[k] >> bit) & 1)
+                mulmodBigInt(result, result, a, mod, &tmp);
+        }
+    }
+
+    freeBigInt(&tmp);
+    return 1;
+}
+
+// ONE WORD OF A LEHMER LINEAR COMBINATION x*u+y*v, WITH SIGNED |x|,|y|<2^32
+static WORD bigint_lincomb(BINT64 x, WORD u, BINT64 y, WORD v,
+        BINT64 * carry)
+{
+    UBINT64 pu = (UBINT64) ((x < 0) ? -x : x) * u;
+    UBINT64 pv = (UBINT64) ((y < 0) ? -y : y) * v;
+    BINT64 lo = *carry, hi = 0;
+
+    if(x < 0) {
+        lo -= (BINT64) (pu & 0xffffffff);
+        hi -= (BINT64) (pu >> 32);
+    }
+    else {
+        lo += (BINT64) (pu & 0xffffffff);
+        hi += (BINT64) (pu >> 32);
+    }
+    if(y < 0) {
+        lo -= (BINT64) (pv & 0xffffffff);
+        hi -= (BINT64) (pv >> 32);
+    }
+    else {
+        lo += (BINT64) (pv & 0xffffffff);
+        hi += (BINT64) (pv >> 32);
+    }
+    *carry = hi + (lo >> 32);
+    return (WORD) lo;
+}
+
+// GREATEST COMMON DIVISOR (LEHMER'S ALGORITHM)
+// THE RESULT IS LEFT IN a, b IS DESTROYED
+
+void gcdBigInt(BIGINT * a, BIGINT * b)
+{
+    BINT64 uh, vh, A, B, C, D, T, q, cu, cv;
+    UBINT64 ul, vl;
+    BINT k, shift;
+    WORD nu, nv;
+
+    a->flags = b->flags = 0;
+    if(bigint_cmpmag(a, b) < 0)
+        swapBigInt(a, b);
+
+    while(b->len > 2) {
+        // LEADING 32 BITS OF a AND THE MATCHING BITS OF b
+        k = a->len - 1;
+        shift = 32 - bigint_clz(a->data[k]);
+        ul = ((UBINT64) a->data[k] << 32) | a->data[k - 1];
+        vl = ((k < b->len) ? ((UBINT64) b->data[k] << 32) : 0) |
+                ((k - 1 < b->len) ? b->data[k - 1] : 0);
+        uh = (BINT64) (ul >> shift);
+        vh = (BINT64) (vl >> shift);
+
+        // SIMULATE EUCLID ON THE LEADING BITS WHILE THE QUOTIENTS AGREE
+        A = 1;
+        B = 0;
+        C = 0;
+        D = 1;
+        while((vh + C) && (vh + D)) {
+            q = (uh + A) / (vh + C);
+            if(q != (uh + B) / (vh + D))
+                break;
+            T = A - q * C;
+            A = C;
+            C = T;
+            T = B - q * D;
+            B = D;
+            D = T;
+            T = uh - q * vh;
+            uh = vh;
+            vh = T;
+        }
+
+        if(!B) {
+            // NO PROGRESS, DO A FULL DIVISION STEP
+            divmodBigInt(0, a, b);
+            swapBigInt(a, b);
+            continue;
+        }
+
+        // a,b=A*a+B*b,C*a+D*b, WORD BY WORD IN PLACE
+        cu = cv = 0;
+        for(k = 0; k < a->len; ++k) {
+            WORD au = a->data[k], bv = (k < b->len) ? b->data[k] : 0;
+            nu = bigint_lincomb(A, au, B, bv, &cu);
+            nv = bigint_lincomb(C, au, D, bv, &cv);
+            a->data[k] = nu;
+            b->data[k] = nv;
+        }
+        b->len = a->len;
+        bigint_trim(a);
+        bigint_trim(b);
+    }
+
+    if(!b->len)
+        return;
+
+    // FINISH WITH 64-BIT INTEGERS
+    divmodBigInt(0, a, b);
+    ul = ((b->len > 1) ? ((UBINT64) b->data[1] << 32) : 0) | b->data[0];
+    vl = ((a->len > 1) ? ((UBINT64) a->data[1] << 32) : 0) |
+            (a->len ? a->data[0] : 0);
+    while(vl) {
+        UBINT64 r = ul % vl;
+        ul = vl;
+        vl = r;
+    }
+    a->data[0] = (WORD) ul;
+    a->data[1] = (WORD) (ul >> 32);
+    a->len = 2;
+    bigint_trim(a);
+}
+
+// result=n!, RETURN 0 IF IT DOESN'T FIT
+// SMALL FACTORS ARE MULTIPLIED TOGETHER IN A SINGLE WORD BEFORE
+// TOUCHING THE BIG NUMBER
+
+BINT factorialBigInt(BIGINT * result, BINT n)
+{
+    UBINT64 acc = 1;
+    BINT k;
+
+    newBigIntFromBINT64(result, 1);
+    for(k = 2; k <= n; ++k) {
+        if(acc * k > 0xffffffffULL) {
+            if(!bigint_mulsmall(result, (WORD) acc, 0))
+                return 0;
+            acc = 1;
+        }
+        acc *= k;
+    }
+    return bigint_mulsmall(result, (WORD) acc, 0);
+}
+
+// *************************************************************************
+// BIGINT OBJECTS: EXACT INTEGERS BEYOND THE 64-BIT RANGE
+// PROLOG, SIGN WORD (0 OR F_NEGATIVE), MAGNITUDE LEAST SIGNIFICANT WORD FIRST
+// THEY ARE ALWAYS NORMALIZED: ANY VALUE THAT FITS A BINT64 IS A BINT
+// THEY ONLY BECOME REALS WHEN MIXED WITH NON-INTEGER NUMBERS
+// *************************************************************************
+
+// LARGEST MAGNITUDE IN WORDS, SO THE SIZE FITS A PROLOG WITHOUT LARGE BLOCKS
+#define BIGINT_MAXOBJWORDS  0x3fff0
+
+// LARGEST MAGNITUDE THAT CONVERTS EXACTLY TO A REAL, 32 BITS ARE < 9.64 DIGITS
+#define BIGINT_EXACTWORDS   ((REAL_PRECISION_MAX*100)/964)
+
+static BINT bigint_fitsBINT64(BIGINT * a)
+{
+    if(a->len < 2)
+        return 1;
+    if(a->len > 2)
+        return 0;
+    if(a->data[1] < 0x80000000U)
+        return 1;
+    // ONLY -2^63 FITS WITH THE TOP BIT SET
+    return (a->flags & F_NEGATIVE) && (a->data[1] == 0x80000000U)
+            && !a->data[0];
+}
+
+static BINT64 bigint_toBINT64(BIGINT * a)
+{
+    UBINT64 mag = 0;
+
+    if(a->len > 1)
+        mag = (UBINT64) a->data[1] << 32;
+    if(a->len)
+        mag |= a->data[0];
+    return (BINT64) ((a->flags & F_NEGATIVE) ? -mag : mag);
+}
+
+// LOAD A BINT OR BIGINT OBJECT, buffer PROVIDES 2 WORDS OF STORAGE FOR BINTS
+// BIGINTS POINT DIRECTLY INTO THE OBJECT, SO THEY ARE ONLY VALID UNTIL THE
+// NEXT ALLOCATION AND MUST NOT BE MODIFIED
+
+static void bigint_read(WORDPTR obj, BIGINT * a, WORD * buffer)
+{
+    if(ISBIGINT(*obj)) {
+        a->data = obj + 2;
+        a->len = a->maxlen = OBJSIZE(*obj) - 1;
+        a->flags = obj[1] & F_NEGATIVE;
+        return;
+    }
+    a->data = buffer;
+    a->maxlen = 2;
+    newBigIntFromBINT64(a, rplReadBINT(obj));
+}
+
+// ALLOCATE A NEW BIGINT OBJECT WITH ROOM FOR maxlen WORDS IN r,
+// FOLLOWED BY scratch WORDS OF TEMPORARY STORAGE
+
+static WORDPTR bigint_newobj(BIGINT * r, BINT maxlen, BINT scratch)
+{
+    WORDPTR obj = rplAllocTempOb(1 + maxlen + scratch);
+
+    if(!obj)
+        return 0;
+    r->data = obj + 2;
+    r->len = 0;
+    r->maxlen = maxlen;
+    r->flags = 0;
+    return obj;
+}
+
+// FINISH AN OBJECT FROM bigint_newobj() WITH ITS RESULT IN r AND PUSH IT
+// RESULTS THAT FIT IN 64 BITS ARE PUSHED AS A BINT INSTEAD
+
+static void bigint_pushobj(WORDPTR obj, BIGINT * r)
+{
+    bigint_trim(r);
+    if(bigint_fitsBINT64(r)) {
+        BINT64 value = bigint_toBINT64(r);
+        rplTruncateLastObject(obj);
+        rplNewBINTPush(value, DECBINT);
+        return;
+    }
+    if(r->len > BIGINT_MAXOBJWORDS) {
+        rplTruncateLastObject(obj);
+        rplError(ERR_NUMBERTOOBIG);
+        return;
+    }
+    obj[0] = MKPROLOG(DOBIGINT, r->len + 1);
+    obj[1] = r->flags & F_NEGATIVE;
+    rplTruncateLastObject(obj + 2 + r->len);
+    rplPushData(obj);
+}
+
+// READ A BIGINT AS A REAL
+// EXACT UP TO BIGINT_EXACTWORDS, ROUNDED TO THE CURRENT PRECISION BEYOND THAT
+// SAME RULES AS rplReadNumberAsReal(): STORAGE IS SHARED BY THE LAST
+// BIGINT2REAL CONVERSIONS
+
+void rplLoadBigIntAsReal(WORDPTR number, REAL * dec)
+{
+    BIGINT a, top;
+    REAL acc, pow2;
+    BINT k, shift, saveprec;
+
+    bigint_read(number, &a, 0);
+
+    // PROVIDE STORAGE
+    dec->data = BigIntDigits + BigInt2RealIdx * BIGINT_REGISTER_STORAGE;
+    dec->flags = 0;
+    dec->exp = 0;
+    dec->len = 1;
+    dec->data[0] = 0;
+    ++BigInt2RealIdx;
+    if(BigInt2RealIdx >= BIGINT2REAL)
+        BigInt2RealIdx = 0;
+
+    if((a.len * 964) / 100 > REAL_EXPONENT_MAX) {
+        rplError(ERR_NUMBERTOOBIG);
+        return;
+    }
+
+    shift = a.len - BIGINT_EXACTWORDS;
+    if(shift < 0)
+        shift = 0;
+
+    top.data = (WORD *) allocRegister();
+    acc.data = allocRegister();
+    if(!top.data || !acc.data) {
+        if(top.data)
+            freeRegister((BINT *) top.data);
+        if(acc.data)
+            freeRegister(acc.data);
+        rplException(EX_OUTOFMEM);
+        return;
+    }
+
+    // CONVERT THE LEADING WORDS EXACTLY
+    top.len = top.maxlen = a.len - shift;
+    top.flags = 0;
+    for(k = 0; k < top.len; ++k)
+        top.data[k] = a.data[shift + k];
+    newRealFromBigInt(&acc, &top);
+    normalize(&acc);
+
+    if(shift) {
+        // SCALE BY 2^(32*shift) WITH BINARY POWERS OF 2^32
+        saveprec = Context.precdigits;
+        Context.precdigits = REAL_PRECISION_MAX;
+        pow2.data = (BINT *) top.data;
+        newRealFromBINT64(&pow2, 4294967296LL, 0);
+        while(shift) {
+            if(shift & 1)
+                mulReal(&acc, &acc, &pow2);
+            shift >>= 1;
+            if(shift)
+                mulReal(&pow2, &pow2, &pow2);
+        }
+        Context.precdigits = saveprec;
+        finalize(&acc);
+        top.data = (WORD *) pow2.data;
+    }
+
+    copyReal(dec, &acc);
+    dec->flags = a.flags & F_NEGATIVE;
+
+    freeRegister(acc.data);
+    freeRegister((BINT *) top.data);
+}
+
+// REPLACE A BIGINT ON THE STACK WITH ITS VALUE AS A REAL
+static void bigint_demote(BINT level)
+{
+    REAL dec;
+    WORDPTR newobj;
+
+    if(!ISBIGINT(*rplPeekData(level)))
+        return;
+    rplLoadBigIntAsReal(rplPeekData(level), &dec);
+    if(Exceptions)
+        return;
+    newobj = rplNewReal(&dec);
+    if(!newobj)
+        return;
+    rplOverwriteData(level, newobj);
+}
+
+// COMPARE 2 BINT OR BIGINT OBJECTS, RETURN -1, 0 OR 1
+static BINT bigint_cmpobj(WORDPTR obj1, WORDPTR obj2)
+{
+    BIGINT a, b;
+    WORD abuf[2], bbuf[2];
+
+    bigint_read(obj1, &a, abuf);
+    bigint_read(obj2, &b, bbuf);
+    return cmpBigInt(&a, &b);
+}
+
+// a^e FOR e>0, r AND t HAVE maxlen WORDS EACH, k IS SCRATCH FOR THE PRODUCTS
+// RETURN A POINTER TO THE BUFFER HOLDING THE RESULT, len RECEIVES ITS LENGTH
+
+static WORD *bigint_powwords(BIGINT * a, UBINT64 e, WORD * r, WORD * t,
+        WORD * k, BINT * len)
+{
+    WORD *tmp;
+    BINT bit, rlen;
+
+    for(bit = 63; !((e >> bit) & 1); --bit);
+
+    for(rlen = 0; rlen < a->len; ++rlen)
+        r[rlen] = a->data[rlen];
+
+    // LEFT TO RIGHT BINARY EXPONENTIATION
+    while(--bit >= 0) {
+        bigint_mulwords(t, r, rlen, r, rlen, k);
+        rlen *= 2;
+        while(!t[rlen - 1])
+            --rlen;
+        tmp = r;
+        r = t;
+        t = tmp;
+        if((e >> bit) & 1) {
+            bigint_mulwords(t, r, rlen, a->data, a->len, k);
+            rlen += a->len;
+            while(!t[rlen - 1])
+                --rlen;
+            tmp = r;
+            r = t;
+            t = tmp;
+        }
+    }
+    *len = rlen;
+    return r;
+}
+
+// EXACT ARITHMETIC ON THE BINT OR BIGINT OBJECTS IN ScratchPointer1 AND
+// ScratchPointer2. PUSH THE RESULT AND RETURN 1, OR RETURN 0 WITHOUT
+// TOUCHING THE STACK IF THE RESULT IS NOT AN INTEGER OR IT'S TOO LARGE
+
+static BINT bigint_arith(WORD op)
+{
+    BIGINT a, b, r, q;
+    WORD abuf[2], bbuf[2];
+    WORDPTR obj;
+    BINT la, lb;
+
+    // ONLY THE LENGTHS SURVIVE THE ALLOCATION, OPERANDS ARE READ AGAIN LATER
+    bigint_read(ScratchPointer1, &a, abuf);
+    bigint_read(ScratchPointer2, &b, bbuf);
+    la = a.len;
+    lb = b.len;
+
+    switch (op) {
+    case OVR_ADD:
+    case OVR_SUB:
+    {
+        BINT maxlen = ((la > lb) ? la : lb) + 1;
+
+        obj = bigint_newobj(&r, maxlen, 0);
+        if(!obj)
+            return 1;
+        bigint_read(ScratchPointer1, &a, abuf);
+        bigint_read(ScratchPointer2, &b, bbuf);
+        if(op == OVR_ADD)
+            addBigInt(&r, &a, &b);
+        else
+            subBigInt(&r, &a, &b);
+        bigint_pushobj(obj, &r);
+        return 1;
+    }
+    case OVR_MUL:
+    {
+        if(la + lb > BIGINT_MAXOBJWORDS)
+            return 0;
+        obj = bigint_newobj(&r, la + lb, bigint_mulscratch(la, lb));
+        if(!obj)
+            return 1;
+        bigint_read(ScratchPointer1, &a, abuf);
+        bigint_read(ScratchPointer2, &b, bbuf);
+        bigint_mulwords(r.data, a.data, a.len, b.data, b.len,
+                r.data + la + lb);
+        r.len = a.len + b.len;
+        r.flags = (a.flags ^ b.flags) & F_NEGATIVE;
+        bigint_pushobj(obj, &r);
+        return 1;
+    }
+    case OVR_DIV:
+    {
+        // ONLY EXACT QUOTIENTS STAY INTEGERS
+        if(!la) {
+            if(!lb)
+                return 0;
+            rplPushData((WORDPTR) zero_bint);
+            return 1;
+        }
+        if(la < lb)
+            return 0;
+        obj = bigint_newobj(&q, la - lb + 1, la + 1 + lb);
+        if(!obj)
+            return 1;
+        bigint_read(ScratchPointer1, &a, abuf);
+        bigint_read(ScratchPointer2, &b, bbuf);
+
+        // DIVISION NEEDS WRITABLE COPIES OF BOTH ARGUMENTS
+        r.data = q.data + q.maxlen;
+        r.maxlen = la + 1;
+        copyBigInt(&r, &a);
+        a.data = r.data + r.maxlen;
+        copyBigInt(&a, &b);
+
+        if(!divmodBigInt(&q, &r, &a) || r.len) {
+            rplTruncateLastObject(obj);
+            return 0;
+        }
+        bigint_pushobj(obj, &q);
+        return 1;
+    }
+    case OVR_POW:
+    {
+        BINT64 e, bits, maxlen;
+        WORD *res;
+        BINT len;
+
+        if(!ISBINT(*ScratchPointer2))
+            return 0;
+        e = rplReadBINT(ScratchPointer2);
+        if(e < 0)
+            return 0;
+        if(!e) {
+            if(!la)
+                return 0;
+            rplPushData((WORDPTR) one_bint);
+            return 1;
+        }
+
+        if(!la)
+            return 0;
+        bits = 32 * (a.len - 1) + 32 - bigint_clz(a.data[a.len - 1]);
+        if(bits > (BINT64) BIGINT_MAXOBJWORDS * 32 / e)
+            return 0;
+        maxlen = bits * e / 32 + 2;
+
+        obj = bigint_newobj(&r, maxlen,
+                maxlen + bigint_mulscratch(maxlen / 2 + 1, maxlen / 2 + 1));
+        if(!obj)
+            return 1;
+        bigint_read(ScratchPointer1, &a, abuf);
+
+        res = bigint_powwords(&a, e, r.data, r.data + maxlen,
+                r.data + 2 * maxlen, &len);
+        if(res != r.data)
+            memmovew(r.data, res, len);
+        r.len = len;
+        r.flags = (e & 1) ? a.flags : 0;
+        bigint_pushobj(obj, &r);
+        return 1;
+    }
+    }
+    return 0;
+}
+
+// n! AS AN EXACT INTEGER BY BINARY SPLITTING
+// FACTORS ARE PACKED IN WORDS FIRST, THEN NEIGHBORING PRODUCTS ARE MULTIPLIED
+// IN PAIRS, SO MOST OF THE WORK IS DONE BY LARGE BALANCED PRODUCTS
+
+void rplNewFactorialPush(BINT n)
+{
+    UBINT64 acc;
+    BINT k, nwords, count, len;
+    WORD *src, *dst, *t, *x, *y;
+    WORDPTR obj;
+    BIGINT r;
+
+    if(n <= 20) {
+        for(acc = 1, k = 2; k <= n; ++k)
+            acc *= k;
+        rplNewBINTPush((BINT64) acc, DECBINT);
+        return;
+    }
+
+    // 600000! ALREADY EXCEEDS THE LARGEST OBJECT
+    if(n > 600000) {
+        rplError(ERR_NUMBERTOOBIG);
+        return;
+    }
+
+    nwords = 1;
+    for(acc = 1, k = 2; k <= n; ++k) {
+        if(acc * k > 0xffffffffULL) {
+            ++nwords;
+            acc = 1;
+        }
+        acc *= k;
+    }
+
+    // 2 BUFFERS OF [LENGTH][WORDS] ENTRIES, THE TOTAL LENGTH OF ALL ENTRIES
+    // NEVER GROWS SO EACH BUFFER NEEDS 2*nwords WORDS
+    obj = bigint_newobj(&r, nwords,
+            3 * nwords + bigint_mulscratch(nwords / 2 + 1, nwords / 2 + 1));
+    if(!obj)
+        return;
+    src = r.data;
+    t = r.data + 4 * nwords;
+
+    dst = src;
+    for(acc = 1, k = 2; k <= n; ++k) {
+        if(acc * k > 0xffffffffULL) {
+            *dst++ = 1;
+            *dst++ = (WORD) acc;
+            acc = 1;
+        }
+        acc *= k;
+    }
+    *dst++ = 1;
+    *dst++ = (WORD) acc;
+    count = nwords;
+
+    while(count > 1) {
+        dst = (src == r.data) ? r.data + 2 * nwords : r.data;
+        x = src;
+        for(k = 0; k < count; k += 2) {
+            if(k + 1 == count) {
+                // ODD ENTRY OUT, CARRY IT TO THE NEXT LEVEL
+                memmovew(dst, x, x[0] + 1);
+                break;
+            }
+            y = x + x[0] + 1;
+            bigint_mulwords(dst + 1, x + 1, x[0], y + 1, y[0], t);
+            len = x[0] + y[0];
+            while(!dst[len])
+                --len;
+            dst[0] = len;
+            dst += len + 1;
+            x = y + y[0] + 1;
+        }
+        src = (src == r.data) ? r.data + 2 * nwords : r.data;
+        count = (count + 1) >> 1;
+    }
+
+    r.len = src[0];
+    memmovew(r.data, src + 1, r.len);
+    bigint_pushobj(obj, &r);
+}
+
 void LIB_HANDLER()
 {
     if(ISPROLOG(CurOpcode)) {
@@ -619,6 +1848,58 @@ void LIB_HANDLER()
         if(nargs == 1) {
             // UNARY OPERATORS
             arg1 = rplPeekData(1);
+            if(ISBIGINT(*arg1)) {
+                switch (OPCODE(CurOpcode)) {
+                case OVR_NEG:
+                case OVR_UMINUS:
+                case OVR_ABS:
+                {
+                    BIGINT a;
+                    WORDPTR newobj;
+
+                    bigint_read(arg1, &a, 0);
+                    if(OPCODE(CurOpcode) == OVR_ABS) {
+                        if(!a.flags)
+                            return;
+                        a.flags = 0;
+                    }
+                    else
+                        a.flags ^= F_NEGATIVE;
+                    if(bigint_fitsBINT64(&a)) {
+                        // ONLY 2^63 NEGATES INTO THE 64-BIT RANGE
+                        rplDropData(1);
+                        rplNewBINTPush(bigint_toBINT64(&a), DECBINT);
+                        return;
+                    }
+                    newobj = rplMakeNewCopy(arg1);
+                    if(!newobj)
+                        return;
+                    newobj[1] ^= F_NEGATIVE;
+                    rplOverwriteData(1, newobj);
+                    return;
+                }
+                case OVR_UPLUS:
+                case OVR_FUNCEVAL:
+                case OVR_EVAL:
+                case OVR_EVAL1:
+                case OVR_XEQ:
+                case OVR_NUM:
+                    // NOTHING TO DO, JUST KEEP THE ARGUMENT IN THE STACK
+                    return;
+                case OVR_NOT:
+                    rplOverwriteData(1, (WORDPTR) zero_bint);
+                    return;
+                case OVR_ISTRUE:
+                    rplOverwriteData(1, (WORDPTR) one_bint);
+                    return;
+                default:
+                    // ANYTHING ELSE IS DONE WITH REALS
+                    bigint_demote(1);
+                    if(!Exceptions)
+                        rplCallOvrOperator(CurOpcode);
+                    return;
+                }
+            }
             if(!ISBINT(*arg1)) {
                 rplError(ERR_INTEGEREXPECTED);
                 return;
@@ -631,6 +1912,106 @@ void LIB_HANDLER()
             arg1 = rplPeekData(2);
             arg2 = rplPeekData(1);
 
+            if(ISBIGINT(*arg1) || ISBIGINT(*arg2)) {
+                BINT isint1 = ISBIGINT(*arg1) || (ISBINT(*arg1)
+                        && !ISAPPROX(*arg1));
+                BINT isint2 = ISBIGINT(*arg2) || (ISBINT(*arg2)
+                        && !ISAPPROX(*arg2));
+
+                if(isint1 && isint2) {
+                    // EXACT INTEGER OPERATIONS
+                    switch (OPCODE(CurOpcode)) {
+                    case OVR_ADD:
+                    case OVR_SUB:
+                    case OVR_MUL:
+                    case OVR_DIV:
+                    case OVR_POW:
+                        if(bigint_arith(OPCODE(CurOpcode))) {
+                            if(!Exceptions) {
+                                rplOverwriteData(3, rplPeekData(1));
+                                rplDropData(2);
+                            }
+                            return;
+                        }
+                        break;
+                    case OVR_EQ:
+                    case OVR_SAME:
+                    case OVR_NOTEQ:
+                    case OVR_LT:
+                    case OVR_GT:
+                    case OVR_LTE:
+                    case OVR_GTE:
+                    case OVR_CMP:
+                    {
+                        BINT res = bigint_cmpobj(arg1, arg2);
+                        switch (OPCODE(CurOpcode)) {
+                        case OVR_EQ:
+                        case OVR_SAME:
+                            res = (res == 0);
+                            break;
+                        case OVR_NOTEQ:
+                            res = (res != 0);
+                            break;
+                        case OVR_LT:
+                            res = (res < 0);
+                            break;
+                        case OVR_GT:
+                            res = (res > 0);
+                            break;
+                        case OVR_LTE:
+                            res = (res <= 0);
+                            break;
+                        case OVR_GTE:
+                            res = (res >= 0);
+                            break;
+                        }
+                        rplDropData(2);
+                        if(res < 0)
+                            rplPushData((WORDPTR) minusone_bint);
+                        else if(res > 0)
+                            rplPushData((WORDPTR) one_bint);
+                        else
+                            rplPushData((WORDPTR) zero_bint);
+                        return;
+                    }
+                    case OVR_AND:
+                    case OVR_OR:
+                    {
+                        // BIGINTS ARE NEVER ZERO
+                        BINT res;
+                        if(OPCODE(CurOpcode) == OVR_AND)
+                            res = !rplIsFalse(arg1) && !rplIsFalse(arg2);
+                        else
+                            res = 1;
+                        rplDropData(2);
+                        rplPushData((WORDPTR) (res ? one_bint : zero_bint));
+                        return;
+                    }
+                    }
+                }
+                else if(!ISNUMBER(*arg1) || !ISNUMBER(*arg2)) {
+                    switch (OPCODE(CurOpcode)) {
+                    case OVR_SAME:
+                    case OVR_EQ:
+                        rplDropData(2);
+                        rplPushFalse();
+                        return;
+                    case OVR_NOTEQ:
+                        rplDropData(2);
+                        rplPushTrue();
+                        return;
+                    }
+                }
+
+                // NOT AN INTEGER RESULT OR MIXED WITH OTHER TYPES, USE REALS
+                bigint_demote(2);
+                if(!Exceptions)
+                    bigint_demote(1);
+                if(!Exceptions)
+                    rplCallOvrOperator(CurOpcode);
+                return;
+            }
+
             if(ISREAL(*arg1)) {
                 rplReadReal(arg1, &rop1);
                 op1type = 1;
@@ -694,7 +2075,10 @@ void LIB_HANDLER()
             if(op1type || op2type) {
                 if(op1type) {
                     rplBINTToRReg(1, op2);
-                    addReal(&RReg[0], &rop1, &RReg[1]);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
+                    if(!rplFastNumericBinary(FASTNUM_ADD, &RReg[0], &rop1, &RReg[1]))
+                        addReal(&RReg[0], &rop1, &RReg[1]);
 
                     if(op1app || op2app)
                         RReg[0].flags |= F_APPROX;
@@ -703,8 +2087,11 @@ void LIB_HANDLER()
                 if(op2type) {
                     // TODO: TRY TO RESPECT THE NUMBER TYPE OF THE FIRST ARGUMENT
                     rplBINTToRReg(1, op1);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    addReal(&RReg[0], &RReg[1], &rop2);
+                    if(!rplFastNumericBinary(FASTNUM_ADD, &RReg[0], &RReg[1], &rop2))
+                        addReal(&RReg[0], &RReg[1], &rop2);
                     if(op1base != DECBINT) {
                         if(isintegerReal(&RReg[0]) && inBINT64Range(&RReg[0])) {
                             rplNewBINTPush(getBINT64Real(&RReg[0]),
@@ -740,6 +2127,9 @@ void LIB_HANDLER()
             }
 
             if((op2 > maxop2) || (op2 < minop2)) {
+                // TOO LARGE FOR 64 BITS, EXACT INTEGERS BECOME A BIGINT
+                if(!op1app && !op2app && bigint_arith(OVR_ADD))
+                    return;
                 // CONVERT BOTH TO REALS
                 rplBINTToRReg(1, op1);
                 rplBINTToRReg(2, op2);
@@ -764,8 +2154,11 @@ void LIB_HANDLER()
             if(op1type || op2type) {
                 if(op1type) {
                     rplBINTToRReg(1, -op2);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    addReal(&RReg[0], &rop1, &RReg[1]);
+                    if(!rplFastNumericBinary(FASTNUM_ADD, &RReg[0], &rop1, &RReg[1]))
+                        addReal(&RReg[0], &rop1, &RReg[1]);
                     if(op1app || op2app)
                         RReg[0].flags |= F_APPROX;
 
@@ -773,8 +2166,11 @@ void LIB_HANDLER()
 
                 if(op2type) {
                     rplBINTToRReg(1, op1);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    subReal(&RReg[0], &RReg[1], &rop2);
+                    if(!rplFastNumericBinary(FASTNUM_SUB, &RReg[0], &RReg[1], &rop2))
+                        subReal(&RReg[0], &RReg[1], &rop2);
 
                     if(op1base != DECBINT) {
                         if(isintegerReal(&RReg[0]) && inBINT64Range(&RReg[0])) {
@@ -812,6 +2208,9 @@ void LIB_HANDLER()
             }
 
             if((-op2 > maxop2) || (-op2 < minop2)) {
+                // TOO LARGE FOR 64 BITS, EXACT INTEGERS BECOME A BIGINT
+                if(!op1app && !op2app && bigint_arith(OVR_SUB))
+                    return;
                 // CONVERT BOTH TO REALS
                 rplBINTToRReg(1, op1);
                 rplBINTToRReg(2, op2);
@@ -835,8 +2234,11 @@ void LIB_HANDLER()
             if(op1type || op2type) {
                 if(op1type) {
                     rplBINTToRReg(1, op2);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    mulReal(&RReg[0], &rop1, &RReg[1]);
+                    if(!rplFastNumericBinary(FASTNUM_MUL, &RReg[0], &rop1, &RReg[1]))
+                        mulReal(&RReg[0], &rop1, &RReg[1]);
                     if(op1app || op2app)
                         RReg[0].flags |= F_APPROX;
 
@@ -845,8 +2247,11 @@ void LIB_HANDLER()
                 if(op2type) {
                     // TODO: TRY TO RESPECT THE NUMBER TYPE OF THE FIRST ARGUMENT
                     rplBINTToRReg(1, op1);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    mulReal(&RReg[0], &RReg[1], &rop2);
+                    if(!rplFastNumericBinary(FASTNUM_MUL, &RReg[0], &RReg[1], &rop2))
+                        mulReal(&RReg[0], &RReg[1], &rop2);
 
                     if(op1base != DECBINT) {
                         if(isintegerReal(&RReg[0]) && inBINT64Range(&RReg[0])) {
@@ -899,6 +2304,10 @@ void LIB_HANDLER()
                 }
             }
 
+            // TOO LARGE FOR 64 BITS, EXACT INTEGERS BECOME A BIGINT
+            if(!op1app && !op2app && bigint_arith(OVR_MUL))
+                return;
+
             rplBINTToRReg(1, op1);
             rplBINTToRReg(2, op2);
 
@@ -918,8 +2327,11 @@ void LIB_HANDLER()
             if(op1type || op2type) {
                 if(op1type) {
                     rplBINTToRReg(1, op2);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    divReal(&RReg[0], &rop1, &RReg[1]);
+                    if(!rplFastNumericBinary(FASTNUM_DIV, &RReg[0], &rop1, &RReg[1]))
+                        divReal(&RReg[0], &rop1, &RReg[1]);
 
                     if(rplTestSystemFlag(FL_COMPLEXMODE)) {
                         if(op2 == 0 && !iszeroReal(&rop1))
@@ -933,8 +2345,11 @@ void LIB_HANDLER()
                 if(op2type) {
                     // TODO: TRY TO RESPECT THE NUMBER TYPE OF THE FIRST ARGUMENT
                     rplBINTToRReg(1, op1);
+                    if(op1app || op2app)
+                        RReg[1].flags |= F_APPROX;
 
-                    divReal(&RReg[0], &RReg[1], &rop2);
+                    if(!rplFastNumericBinary(FASTNUM_DIV, &RReg[0], &RReg[1], &rop2))
+                        divReal(&RReg[0], &RReg[1], &rop2);
 
                     if(rplTestSystemFlag(FL_COMPLEXMODE)) {
                         if(iszeroReal(&rop2) && op1 != 0)
@@ -966,8 +2381,11 @@ void LIB_HANDLER()
             }
             rplBINTToRReg(1, op1);
             rplBINTToRReg(2, op2);
+            if(op1app || op2app)
+                RReg[1].flags |= F_APPROX;
 
-            divReal(&RReg[0], &RReg[1], &RReg[2]);
+            if(!rplFastNumericBinary(FASTNUM_DIV, &RReg[0], &RReg[1], &RReg[2]))
+                divReal(&RReg[0], &RReg[1], &RReg[2]);
 
             if(rplTestSystemFlag(FL_COMPLEXMODE)) {
                 if(op2 == 0 && op1 != 0)
@@ -1081,8 +2499,13 @@ void LIB_HANDLER()
                 rplNewBINTPush(result,
                         LIBNUM(*arg1) | (LIBNUM(*arg2) & APPROX_BIT));
             }
-            else
+            else {
+                // TOO LARGE FOR 64 BITS, EXACT INTEGERS BECOME A BIGINT
+                if(!op1app && !op2app && (op2 > 0)
+                        && bigint_arith(OVR_POW))
+                    return;
                 rplNewRealFromRRegPush(0);
+            }
             if(!Exceptions)
                 rplCheckResultAndError(&RReg[0]);
 
@@ -1484,6 +2907,13 @@ void LIB_HANDLER()
             return;
         case OVR_NEG:
         case OVR_UMINUS:
+            if((op1 == MIN_BINT) && !ISAPPROX(*arg1)) {
+                // 2^63 DOESN'T FIT IN 64 BITS, MAKE IT A BIGINT
+                arg2 = arg1;
+                arg1 = (WORDPTR) zero_bint;
+                bigint_arith(OVR_SUB);
+                return;
+            }
             op1 = -op1;
             rplNewBINTPush(op1, LIBNUM(*arg1));
             return;
@@ -1497,7 +2927,13 @@ void LIB_HANDLER()
             rplPushData(arg1);
             return;
         case OVR_ABS:
-            if(op1 < 0)
+            if((op1 == MIN_BINT) && !ISAPPROX(*arg1)) {
+                // 2^63 DOESN'T FIT IN 64 BITS, MAKE IT A BIGINT
+                arg2 = arg1;
+                arg1 = (WORDPTR) zero_bint;
+                bigint_arith(OVR_SUB);
+            }
+            else if(op1 < 0)
                 rplNewBINTPush(-op1, LIBNUM(*arg1));
             else
                 rplPushData(arg1);
@@ -1529,7 +2965,7 @@ void LIB_HANDLER()
     BINT64 result;
     UBINT64 uresult;
     BYTEPTR strptr, strend;
-    int base, libbase, digit, count, neg, argnum1;
+    int base, libbase, digit, count, neg, argnum1, isbig;
     char basechr;
 
     if(OPCODE(CurOpcode) >= MIN_RESERVED_OPCODE) {
@@ -1634,6 +3070,11 @@ void LIB_HANDLER()
                 --strend;
             }
 
+            // REMEMBER WHERE THE DIGITS ARE IN CASE THE NUMBER NEEDS A BIGINT
+            BINT digitoff = strptr - (BYTEPTR) TokenStart;
+            BINT digitend = strend - (BYTEPTR) TokenStart;
+            isbig = 0;
+
             for(count = 0; count < argnum1; ++count) {
                 digit = utf82cp((char *)strptr, (char *)strend);
                 strptr = (BYTEPTR) utf8skipst((char *)strptr, (char *)strend);
@@ -1653,17 +3094,19 @@ void LIB_HANDLER()
                     digit += 100;
 
                 if((digit >= 0) && (digit < base)) {
-                    if(((result >> 32) * base) >> 31) {
-                        // OVERFLOW, CANNOT BE AN INTEGER
-                        RetNum = ERR_NOTMINE;
-                        return;
+                    if(isbig)
+                        continue;
+                    if((((result >> 32) * base) >> 31)
+                            || ((result * base + digit) >> 63)) {
+                        // OVERFLOW, ONLY EXACT DECIMAL INTEGERS CAN BE BIGINTS
+                        if(libbase != DECBINT) {
+                            RetNum = ERR_NOTMINE;
+                            return;
+                        }
+                        isbig = 1;
+                        continue;
                     }
                     result = result * base + digit;
-                    if(result >> 63) {
-                        // OVERFLOW, CANNOT BE AN INTEGER
-                        RetNum = ERR_NOTMINE;
-                        return;
-                    }
                 }
                 else {
                     // AN INVALID DIGIT
@@ -1682,6 +3125,61 @@ void LIB_HANDLER()
                 return;
             }
 
+            if(isbig) {
+                // COMPILE A BIGINT, 9 DIGITS AT A TIME
+                // 1 DIGIT IS LESS THAN 3402/32768 WORDS
+                BIGINT big;
+                BINT nwords = (BINT) (((BINT64) argnum1 * 3402) >> 15) + 2;
+                WORD chunk = 0, scale = 1;
+                WORDPTR obj;
+
+                if(nwords > BIGINT_MAXOBJWORDS) {
+                    RetNum = ERR_NOTMINE;
+                    return;
+                }
+                obj = rplCompileAppendWords(nwords + 2);
+                if(Exceptions) {
+                    RetNum = ERR_INVALID;
+                    return;
+                }
+                big.data = obj + 2;
+                big.len = 0;
+                big.maxlen = nwords;
+                big.flags = neg ? F_NEGATIVE : 0;
+
+                // THE TOKEN MAY HAVE MOVED, SCAN IT AGAIN
+                strptr = (BYTEPTR) TokenStart + digitoff;
+                strend = (BYTEPTR) TokenStart + digitend;
+                while(strptr < strend) {
+                    digit = utf82cp((char *)strptr, (char *)strend);
+                    strptr = (BYTEPTR) utf8skipst((char *)strptr,
+                            (char *)strend);
+                    if((WORD) digit == THOUSAND_SEP(Locale))
+                        continue;
+                    chunk = chunk * 10 + (digit - '0');
+                    scale *= 10;
+                    if(scale == 1000000000) {
+                        bigint_mulsmall(&big, scale, chunk);
+                        chunk = 0;
+                        scale = 1;
+                    }
+                }
+                if(scale > 1)
+                    bigint_mulsmall(&big, scale, chunk);
+
+                if(!bigint_fitsBINT64(&big)) {
+                    obj[0] = MKPROLOG(DOBIGINT, big.len + 1);
+                    obj[1] = big.flags;
+                    rplCompileRemoveWords(nwords - big.len);
+                    RetNum = OK_CONTINUE;
+                    return;
+                }
+                // -2^63 STILL FITS A BINT
+                result = bigint_toBINT64(&big);
+                neg = 0;
+                rplCompileRemoveWords(nwords + 2);
+            }
+
             // FINISHED CONVERSION, NOW COMPILE TO SINT OR BINT AS NEEDED
             if(neg)
                 result = -result;
@@ -1704,6 +3202,46 @@ void LIB_HANDLER()
             // DecompileObject = Ptr to WORD of object to decompile
             // DecompStringEnd = Byte Ptr to end of current string. Write here with rplDecompAppendString(); rplDecompAppendChar();
 
+            if(ISBIGINT(*DecompileObject)) {
+                // ALL DIGITS ARE ALWAYS SHOWN, 9 AT A TIME FROM THE LEAST SIGNIFICANT END
+                BIGINT big;
+                BINT nwords = OBJSIZE(*DecompileObject) - 1;
+                BINT nbytes = 4 * nwords + 3 + (nwords * 964) / 100 + 2;
+                BYTEPTR start, ptr;
+                WORD chunk;
+
+                if(DecompileObject[1] & F_NEGATIVE)
+                    rplDecompAppendChar('-');
+
+                // RESERVE ROOM FOR A WORKING COPY OF THE NUMBER FOLLOWED BY THE DIGITS
+                rplDecompAppendString2(0, nbytes);
+                if(Exceptions) {
+                    RetNum = ERR_INVALID;
+                    return;
+                }
+                start = (BYTEPTR) DecompStringEnd - nbytes;
+                big.data =
+                        (WORD *) (((PTR2NUMBER) start + 3) & ~((PTR2NUMBER) 3));
+                big.len = big.maxlen = nwords;
+                big.flags = 0;
+                memmovew(big.data, DecompileObject + 2, nwords);
+
+                ptr = (BYTEPTR) DecompStringEnd;
+                while(big.len) {
+                    chunk = bigint_divsmall(&big, 1000000000);
+                    for(count = 0; (count < 9) && (big.len || chunk); ++count) {
+                        *--ptr = '0' + chunk % 10;
+                        chunk /= 10;
+                    }
+                }
+                count = (BYTEPTR) DecompStringEnd - ptr;
+                memmoveb(start, ptr, count);
+                DecompStringEnd = (WORDPTR) (start + count);
+
+                RetNum = OK_CONTINUE;
+                return;
+            }
+
             if(ISPROLOG(*DecompileObject)) {
                 // THERE'S A PAYLOAD, READ THE NUMBER
                 result = *((BINT64 *) (DecompileObject + 1));
@@ -1946,6 +3484,7 @@ void LIB_HANDLER()
 
             // NOW WITH A PROPER BASE SELECTED, VERIFY THAT ALL DIGITS ARE NUMERIC
 
+            isbig = 0;
             for(count = 0; count < argnum1; ++count) {
                 digit = strptr[count];
                 if((digit >= '0') && (digit <= '9'))
@@ -1958,10 +3497,16 @@ void LIB_HANDLER()
                     digit += 100;
 
                 if((digit >= 0) && (digit < base)) {
+                    if(isbig)
+                        continue;
                     if(((result >> 32) * base) >> 31) {
-                        // OVERFLOW, CANNOT BE AN INTEGER
-                        RetNum = ERR_NOTMINE;
-                        return;
+                        // OVERFLOW, ONLY PLAIN DECIMAL INTEGERS CAN BE BIGINTS
+                        if(neg) {
+                            RetNum = ERR_NOTMINE;
+                            return;
+                        }
+                        isbig = 1;
+                        continue;
                     }
                     result = result * base + digit;
                 }
@@ -1977,8 +3522,14 @@ void LIB_HANDLER()
                             RetNum = ERR_NOTMINE;
                             return;
                         }
-                        if(digit == ('.' + 100))
+                        if(digit == ('.' + 100)) {
+                            // A LARGE NUMBER WITH A DOT IS A REAL
+                            if(isbig) {
+                                RetNum = ERR_NOTMINE;
+                                return;
+                            }
                             ++count;
+                        }
                         // REPORT AS MANY VALID DIGITS AS POSSIBLE
                         RetNum = OK_TOKENINFO | MKTOKENINFO((strptr + count) -
                                 (BYTEPTR) TokenStart, TITYPE_INTEGER, 0, 1);
@@ -2003,9 +3554,11 @@ void LIB_HANDLER()
             // FOR NUMBERS: TYPE=10 (REALS), SUBTYPES = .01 = APPROX., .02 = INTEGER, .03 = APPROX. INTEGER
             // .12 =  BINARY INTEGER, .22 = DECIMAL INT., .32 = OCTAL BINT, .42 = HEX INTEGER
         {
+            // BIGINTS ARE REPORTED AS EXACT DECIMAL INTEGERS
+            BINT libnum = ISBIGINT(*ObjectPTR) ? DECBINT : LIBNUM(*ObjectPTR);
             TypeInfo =
-                    DOREAL * 100 + 2 + ((LIBNUM(*ObjectPTR) -
-                        LIBRARY_NUMBER) & 1) + ((LIBNUM(*ObjectPTR) -
+                    DOREAL * 100 + 2 + ((libnum -
+                        LIBRARY_NUMBER) & 1) + ((libnum -
                         LIBRARY_NUMBER) >> 1) * 10;
             DecompHints = 0;
             RetNum = OK_TOKENINFO | MKTOKENINFO(0, TITYPE_INTEGER, 0, 1);
@@ -2034,7 +3587,20 @@ void LIB_HANDLER()
             // VERIFY IF THE OBJECT IS PROPERLY FORMED AND VALID
             // ObjectPTR = POINTER TO THE OBJECT TO CHECK
             // LIBRARY MUST RETURN: RetNum=OK_CONTINUE IF OBJECT IS VALID OR RetNum=ERR_INVALID IF IT'S INVALID
-            if(ISPROLOG(*ObjectPTR)) {
+            if(ISBIGINT(*ObjectPTR)) {
+                // SIGN WORD AND A NORMALIZED MAGNITUDE OUTSIDE THE 64-BIT RANGE
+                BIGINT big;
+                if((OBJSIZE(*ObjectPTR) < 3) || (ObjectPTR[1] & ~F_NEGATIVE)) {
+                    RetNum = ERR_INVALID;
+                    return;
+                }
+                bigint_read(ObjectPTR, &big, 0);
+                if(!big.data[big.len - 1] || bigint_fitsBINT64(&big)) {
+                    RetNum = ERR_INVALID;
+                    return;
+                }
+            }
+            else if(ISPROLOG(*ObjectPTR)) {
                 if(OBJSIZE(*ObjectPTR) != 2) {
                     RetNum = ERR_INVALID;
                     return;
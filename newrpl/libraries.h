@@ -157,6 +157,8 @@ enum CompileErrors
 
 void libCompileCmds(BINT libnum, char *libnames[], WORD libopcodes[],
         int numcmds);
+void libInstallCmds(const HALFWORD libnumbers[], char *libnames[],
+        int numcmds);
 void libDecompileCmds(char *libnames[], WORD libopcodes[], int numcmds);
 void libProbeCmds(char *libnames[], BINT tokeninfo[], int numcmds);
 void libGetInfo(WORD opcode, char *libnames[], WORD libopcodes[],
@@ -170,6 +172,14 @@ void libFindMsg(BINT message, WORDPTR table);
 WORD libComputeHash(WORDPTR object);
 WORD libComputeHash2(WORDPTR start, BINT nwords);
 
+// ENTRY IN THE COMMAND NAME INDEX USED BY THE COMPILER
+typedef struct
+{
+    const char *name;
+    HALFWORD libnum;
+    HALFWORD next;      // INDEX+1 OF THE NEXT ENTRY IN THE SAME BUCKET, 0=END OF CHAIN
+} CMDINDEXENTRY;
+
 // BITS USED IN MOST OBJECTS
 #define APPROX_BIT    1
 
@@ -250,6 +260,8 @@ WORD libComputeHash2(WORDPTR start, BINT nwords);
 
 #define DOCMPLX     30
 
+#define DOBIGINT    31  // ARBITRARY PRECISION INTEGERS, HANDLED BY THE BINT LIBRARY
+
 // IDENTS TAKE ALL LIBRARIES BETWEEN 32 AND 47 INCLUDED
 // 4 BITS ARE USED FOR FLAGS IN THE LIBRARY NUMBER
 #define DOIDENT     32  // THIS IS FOR QUOTED IDENTS, BEING PUSHED IN THE STACK
@@ -309,6 +321,7 @@ WORD libComputeHash2(WORDPTR start, BINT nwords);
 #define ISBINT(prolog) ( ((OPCODE(prolog)<0x400000) || ISPROLOG(prolog)) && (((LIBNUM(prolog)&~APPROX_BIT)>=BINBINT) && ((LIBNUM(prolog)&~APPROX_BIT)<=HEXBINT)))
 #define ISLIST(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)&~1)==DOLIST))
 #define ISAUTOEXPLIST(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==DOLIST+1))
+#define ISBIGINT(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==DOBIGINT))
 #define ISREAL(prolog) ( ISPROLOG(prolog) && (((LIBNUM(prolog)&~APPROX_BIT)==DOREAL)))
 #define ISCOMPLEX(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)==DOCMPLX)))
 #define ISCONSTANT(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)==DOCONST)))
@@ -316,13 +329,13 @@ WORD libComputeHash2(WORDPTR start, BINT nwords);
 #define ISCPLXCONSTANT(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)==DOCONST)) && (!((prolog)&1)))
 #define ISPROGRAM(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)==DOCOL) || (LIBNUM(prolog)==SECO)))
 #define ISSECO(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==SECO))
-#define ISNUMBER(prolog) (ISBINT(prolog)||ISREAL(prolog)||ISREALCONSTANT(prolog))
-#define ISNUMBERORANGLE(prolog) (ISBINT(prolog)||ISREAL(prolog)||ISANGLE(prolog)||ISREALCONSTANT(prolog))
-#define ISNUMBERCPLX(prolog) (ISBINT(prolog)||ISREAL(prolog)||ISCOMPLEX(prolog)||ISCONSTANT(prolog))
+#define ISNUMBER(prolog) (ISBINT(prolog)||ISBIGINT(prolog)||ISREAL(prolog)||ISREALCONSTANT(prolog))
+#define ISNUMBERORANGLE(prolog) (ISBINT(prolog)||ISBIGINT(prolog)||ISREAL(prolog)||ISANGLE(prolog)||ISREALCONSTANT(prolog))
+#define ISNUMBERCPLX(prolog) (ISBINT(prolog)||ISBIGINT(prolog)||ISREAL(prolog)||ISCOMPLEX(prolog)||ISCONSTANT(prolog))
 #define ISSTRING(prolog) (ISPROLOG(prolog) && ((LIBNUM(prolog)&~3)==DOSTRING))
 
 #define ISUNIT(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==DOUNIT))
-#define ISNUMBERORUNIT(prolog) (ISBINT(prolog)||ISREAL(prolog)||ISUNIT(prolog)||ISANGLE(prolog))
+#define ISNUMBERORUNIT(prolog) (ISBINT(prolog)||ISBIGINT(prolog)||ISREAL(prolog)||ISUNIT(prolog)||ISANGLE(prolog))
 
 #define ISANGLE(prolog)   (ISPROLOG(prolog) && ((LIBNUM(prolog)&~3)==DOANGLE))
 
@@ -331,7 +344,8 @@ WORD libComputeHash2(WORDPTR start, BINT nwords);
 #define ISDIR(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==DODIR))
 #define ISPACKEDDIR(prolog) ( ISPROLOG(prolog) && (LIBNUM(prolog)==DOPACKDIR))
 
-#define ISAPPROX(prolog) ((LIBNUM(prolog)&APPROX_BIT))
+// DOBIGINT IS ODD BUT BIG INTEGERS ARE ALWAYS EXACT
+#define ISAPPROX(prolog) ((LIBNUM(prolog)&APPROX_BIT) && (LIBNUM(prolog)!=DOBIGINT))
 
 #define ISCOMMENT(prolog) ( ISPROLOG(prolog) && ((LIBNUM(prolog)&~3)==DOCOMMENT))
 
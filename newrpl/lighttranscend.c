@@ -25,6 +25,9 @@
 #define ATAN_TABLES_LEN     (2016/8)
 #define ATAN_TABLES_PASSES  7
 
+// ABOVE THIS PRECISION, POWER SERIES TERMS ARE COMPUTED WITH SHRINKING PRECISION
+#define SERIES_SHRINK_MINPREC   64
+
 // TRANSCENDENTAL FUNCTIONS TABLES
 extern const BINT const atan_ltable[9 * ATAN_TABLES_PASSES * ATAN_TABLES_LEN];
 extern const BINT const ln_ltable[LNTABLE_ENTRIES * LNTABLE_LEN];
@@ -597,6 +600,46 @@ void decconst_200(REAL * real)
     real->len = 1;
 }
 
+// RETURN HOW MANY DIGITS THE NEXT TERM OF A POWER SERIES NEEDS
+// A TERM MUCH SMALLER THAN THE ACCUMULATOR ONLY AFFECTS ITS LAST DIGITS,
+// SO THE TERM CAN BE COMPUTED AT A REDUCED PRECISION
+
+static int series_digits(REAL * acc, REAL * term, int prec)
+{
+    int digits;
+
+    if((prec < SERIES_SHRINK_MINPREC) || iszeroReal(acc))
+        return prec;
+
+    digits = prec - ((acc->exp + (acc->len << 3)) - (term->exp +
+                (term->len << 3)));
+    digits = (digits + 15) & ~7;        // ONE EXTRA GUARD WORD
+    if(digits < 16)
+        digits = 16;
+    if(digits > prec)
+        digits = prec;
+    return digits;
+}
+
+// MAKE view A READ-ONLY COPY OF x WITH ONLY THE MOST SIGNIFICANT digits
+// VIEW SHARES THE DATA WITH x, LOWER WORDS ARE TRUNCATED
+
+static void series_truncate(REAL * view, REAL * x, int digits)
+{
+    int words = ((digits + 7) >> 3) + 1;
+
+    view->data = x->data;
+    view->exp = x->exp;
+    view->flags = x->flags;
+    view->len = x->len;
+
+    if(words < x->len) {
+        view->data += x->len - words;
+        view->exp += (x->len - words) << 3;
+        view->len = words;
+    }
+}
+
 // COMPUTE SQUARE ROOT OF RReg[0] USING POWER SERIES
 // RESULT IS RReg[0]=SQRT(RReg[0]), RReg[1]=1/SQRT(RReg[0]
 
@@ -1005,6 +1048,8 @@ void trig_reduceangle(REAL * angle, BINT angmode)
 
 static void cospower()
 {
+    int seriesprec;
+    REAL xview;
     int k;
     int orgexp, digits;
     int needdigits = Context.precdigits;
@@ -1047,12 +1092,16 @@ static void cospower()
     RReg[4].data[0] = 0;        // ACCUMULATOR
 
 // DO AS MANY TERMS AS NEEDED
+    seriesprec = Context.precdigits;
     for(k = 2; k <= REAL_PRECISION_MAX / 2; k += 2) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X^2
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X^2
         //normalize(&RReg[1]);
         RReg[2].data[0] = k * (k - 1);
         divReal(&RReg[0], &RReg[1], &RReg[2]);  // NEWTERM= TERM*X^2/(k*(k-1)) = X^K/K!
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[0]);
 
         if(eqReal(&RReg[4], &RReg[5]))
@@ -1127,6 +1176,8 @@ static void cospower()
 
 static void sinpower()
 {
+    int seriesprec;
+    REAL xview;
     int k;
     int orgexp, digits;
     int needdigits = Context.precdigits;
@@ -1171,12 +1222,16 @@ static void sinpower()
     copyReal(&RReg[4], &RReg[0]);       // ACCUMULATOR
 
 // DO AS MANY TERMS AS NEEDED
+    seriesprec = Context.precdigits;
     for(k = 3; k <= REAL_PRECISION_MAX / 2; k += 2) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X^2
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X^2
         //normalize(&RReg[1]);
         RReg[2].data[0] = k * (k - 1);
         divReal(&RReg[0], &RReg[1], &RReg[2]);  // NEWTERM= TERM*X^2/(k*(k-1)) = X^K/K!
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[0]);
 
         if(eqReal(&RReg[4], &RReg[5]))
@@ -1869,6 +1924,8 @@ void trig_tan(REAL * angle, BINT angmode)
 
 static void atanpower()
 {
+    int seriesprec;
+    REAL xview;
     int neg, invert, pass;
     int savedprec = Context.precdigits;
     int k;
@@ -1960,14 +2017,18 @@ static void atanpower()
     copyReal(&RReg[4], &RReg[0]);       // ACCUMULATOR
 
     // DO AS MANY TERMS AS NEEDED
+    seriesprec = Context.precdigits;
     for(k = 3; 1; k += 2) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X^2
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X^2
 
         RReg[2].data[0] = k;
         divReal(&RReg[0], &RReg[1], &RReg[2]);  // NEWTERM= TERM*X^2/(K))=X^K/K
         RReg[2].flags ^= F_NEGATIVE;
         swapReal(&RReg[0], &RReg[1]);
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[1]);
 
         if(eqReal(&RReg[4], &RReg[5]))
@@ -2376,6 +2437,8 @@ static const BINT64 const powof10[19]={
 
 void pexp()
 {
+    int seriesprec;
+    REAL xview;
 
     // CONCEPT: IF LN(X)=LN(A)+N*LN(10)
     // THEN X=m+N*LN(10) EXP(X) = EXP(m)*10^N
@@ -2478,11 +2541,15 @@ void pexp()
     addReal(&RReg[4], &RReg[2], &RReg[0]);      // ACCUMULATOR STARTS FROM 1+X
 
     // DO AS MANY TERMS AS NEEDED
+    seriesprec = Context.precdigits;
     for(k = 2; 1; k++) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X
         RReg[2].data[0] = k;
         divReal(&RReg[0], &RReg[1], &RReg[2]);  // NEWTERM= TERM*X/k = X^K/K!
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[0]);
 
         if(eqReal(&RReg[4], &RReg[5]))
@@ -2547,6 +2614,8 @@ void pexp()
 // SAME THING BUT FOR EXP(X)-1
 void pexpm()
 {
+    int seriesprec;
+    REAL xview;
 
     int k;
 
@@ -2564,11 +2633,15 @@ void pexpm()
     copyReal(&RReg[4], &RReg[0]);       // ACCUMULATOR STARTS FROM X
 
     // DO AS MANY TERMS AS NEEDED
+    seriesprec = Context.precdigits;
     for(k = 2; 1; k++) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X
         RReg[2].data[0] = k;
         divReal(&RReg[0], &RReg[1], &RReg[2]);  // NEWTERM= TERM*X/k = X^K/K!
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[0]);
 
         if(eqReal(&RReg[4], &RReg[5]))
@@ -2592,6 +2665,8 @@ void pexpm()
 
 void pln()
 {
+    int seriesprec;
+    REAL xview;
     int orgexp, digits, correction;
     int adjustment_const[LNTABLE_ENTRIES];
     int k;
@@ -2699,14 +2774,18 @@ void pln()
 
     // NEWTERM=OLDTERM*X/k
 
+    seriesprec = Context.precdigits;
     for(k = 2; 1; k++) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X
 
         RReg[2].data[0] = k;
 
         divReal(&RReg[6], &RReg[1], &RReg[2]);  // NEWTERM=OLDTERM*X/K
         swapReal(&RReg[0], &RReg[1]);
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[5], and X^k IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[6]);
         RReg[2].flags ^= F_NEGATIVE;
         if(eqReal(&RReg[4], &RReg[5]))
@@ -2766,6 +2845,8 @@ void pln()
 // LN(X+1)
 void plnp1()
 {
+    int seriesprec;
+    REAL xview;
     int k;
     Context.precdigits += 16;
     // USE THE POWER SERIES LN(X+1)=X-X^2/2+X^3/3-...
@@ -2784,14 +2865,18 @@ void plnp1()
 
     // NEWTERM=OLDTERM*X/k
 
+    seriesprec = Context.precdigits;
     for(k = 2; 1; k++) {
-        mulReal(&RReg[1], &RReg[0], &RReg[3]);  // TERM*X
+        Context.precdigits = series_digits(&RReg[4], &RReg[0], seriesprec);
+        series_truncate(&xview, &RReg[3], Context.precdigits);
+        mulReal(&RReg[1], &RReg[0], &xview);  // TERM*X
 
         RReg[2].data[0] = k;
 
         divReal(&RReg[6], &RReg[1], &RReg[2]);  // NEWTERM=OLDTERM*X/K
         swapReal(&RReg[0], &RReg[1]);
         // HERE WE HAVE THE NEW TERM OF THE SERIES IN RReg[5], and X^k IN RReg[0]
+        Context.precdigits = seriesprec;
         addReal(&RReg[5], &RReg[4], &RReg[6]);
         RReg[2].flags ^= F_NEGATIVE;
         if(eqReal(&RReg[4], &RReg[5]))
@@ -3498,3 +3583,167 @@ void xrootReal(REAL * result, REAL * x, REAL * a)
     result->flags |= approx | isneg;
 
 }
+
+// ENTRY POINTS USING AN EXPLICIT CONTEXT
+// RESULTS ARE LEFT IN THE RReg[] OF THAT CONTEXT, SAME AS THE FUNCTIONS ABOVE
+
+void hyp_expCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_exp(x);
+    selectContext(prev);
+}
+
+void hyp_expmCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_expm(x);
+    selectContext(prev);
+}
+
+void hyp_lnCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_ln(x);
+    selectContext(prev);
+}
+
+void hyp_lnp1Ctx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_lnp1(x);
+    selectContext(prev);
+}
+
+void hyp_logCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_log(x);
+    selectContext(prev);
+}
+
+void hyp_powCtx(DECIMAL_CONTEXT * ctx, REAL * x, REAL * a)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_pow(x, a);
+    selectContext(prev);
+}
+
+void hyp_sqrtCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_sqrt(x);
+    selectContext(prev);
+}
+
+void hyp_sinhcoshCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_sinhcosh(x);
+    selectContext(prev);
+}
+
+void hyp_tanhCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_tanh(x);
+    selectContext(prev);
+}
+
+void hyp_sinhCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_sinh(x);
+    selectContext(prev);
+}
+
+void hyp_coshCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_cosh(x);
+    selectContext(prev);
+}
+
+void hyp_atanhCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_atanh(x);
+    selectContext(prev);
+}
+
+void hyp_asinhCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_asinh(x);
+    selectContext(prev);
+}
+
+void hyp_acoshCtx(DECIMAL_CONTEXT * ctx, REAL * x)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    hyp_acosh(x);
+    selectContext(prev);
+}
+
+void trig_sincosCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_sincos(angle, angmode);
+    selectContext(prev);
+}
+
+void trig_sinCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_sin(angle, angmode);
+    selectContext(prev);
+}
+
+void trig_cosCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_cos(angle, angmode);
+    selectContext(prev);
+}
+
+void trig_tanCtx(DECIMAL_CONTEXT * ctx, REAL * angle, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_tan(angle, angmode);
+    selectContext(prev);
+}
+
+void trig_atan2Ctx(DECIMAL_CONTEXT * ctx, REAL * y, REAL * x, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_atan2(y, x, angmode);
+    selectContext(prev);
+}
+
+void trig_asinCtx(DECIMAL_CONTEXT * ctx, REAL * x, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_asin(x, angmode);
+    selectContext(prev);
+}
+
+void trig_acosCtx(DECIMAL_CONTEXT * ctx, REAL * x, BINT angmode)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    trig_acos(x, angmode);
+    selectContext(prev);
+}
+
+void powRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * x, REAL * a)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    powReal(result, x, a);
+    selectContext(prev);
+}
+
+void xrootRealCtx(DECIMAL_CONTEXT * ctx, REAL * result, REAL * x, REAL * a)
+{
+    DECIMAL_CONTEXT *prev = selectContext(ctx);
+    xrootReal(result, x, a);
+    selectContext(prev);
+}
@@ -47,9 +47,127 @@ BINT rplExplodeList2(WORDPTR composite)
     return count;
 }
 
+// DROP ALL LIST INDEXES, MUST BE CALLED WHENEVER OBJECTS MOVE IN TEMPOB
+void rplClearListIndex()
+{
+    BINT k;
+    for(k = 0; k < LISTINDEXLISTS; ++k)
+        ListIndexList[k] = 0;
+    ListIndexNext = 0;
+}
+
+// DROP THE INDEXES OF ALL LISTS AT OR ABOVE limit
+// CALLED WHEN TEMPOB IS TRUNCATED, SINCE THE SAME ADDRESS WILL BE REUSED
+void rplReleaseListIndex(WORDPTR limit)
+{
+    BINT k;
+    for(k = 0; k < LISTINDEXLISTS; ++k)
+        if(ListIndexList[k] >= limit)
+            ListIndexList[k] = 0;
+}
+
+// GET THE OFFSET INDEX OF A LIST, BUILDING IT IF NEEDED
+// RETURNS -1 IF THE LIST IS TOO SMALL TO BE WORTH INDEXING
+static BINT rplListIndexGet(WORDPTR composite)
+{
+    BINT k, count, shift;
+    WORD *offsets;
+    WORDPTR ptr, end;
+
+    if(OBJSIZE(*composite) < LISTINDEXMINSIZE)
+        return -1;
+
+    for(k = 0; k < LISTINDEXLISTS; ++k) {
+        if(ListIndexList[k] == composite) {
+            if(ListIndexProlog[k] == *composite)
+                return k;
+            ListIndexList[k] = 0;       // STALE, REBUILD IT
+            break;
+        }
+    }
+
+    for(k = 0; k < LISTINDEXLISTS; ++k)
+        if(!ListIndexList[k])
+            break;
+    if(k == LISTINDEXLISTS) {
+        k = ListIndexNext;
+        ListIndexNext = (ListIndexNext + 1) % LISTINDEXLISTS;
+    }
+
+    // STORE THE OFFSET OF EVERY ELEMENT, WHEN THE TABLE IS FULL
+    // KEEP ONLY EVERY OTHER ONE AND DOUBLE THE SPACING
+    offsets = ListIndexOffset + k * LISTINDEXSIZE;
+    count = 0;
+    shift = 0;
+    ptr = composite + 1;
+    end = composite + OBJSIZE(*composite);      // POINT TO THE END MARKER
+    while(ptr < end) {
+        if(!(count & ((1 << shift) - 1))) {
+            if((count >> shift) == LISTINDEXSIZE) {
+                BINT j;
+                for(j = 0; j < LISTINDEXSIZE / 2; ++j)
+                    offsets[j] = offsets[2 * j];
+                ++shift;
+            }
+            if(!(count & ((1 << shift) - 1)))
+                offsets[count >> shift] = ptr - composite;
+        }
+        ptr = rplSkipOb(ptr);
+        ++count;
+    }
+
+    ListIndexList[k] = composite;
+    ListIndexProlog[k] = *composite;
+    ListIndexCount[k] = count;
+    ListIndexShift[k] = shift;
+    return k;
+}
+
+// INDEX A LIST CREATED FROM AN INDEXED LIST BY REPLACING THE ELEMENT AT
+// position, WHICH CHANGED SIZE BY delta WORDS. AVOIDS SCANNING THE NEW LIST
+static void rplListIndexDerive(WORDPTR oldlist, WORDPTR newlist,
+        BINT position, BINT delta)
+{
+    BINT k, n, j, nentries;
+    WORD *src, *dest;
+
+    for(k = 0; k < LISTINDEXLISTS; ++k)
+        if((ListIndexList[k] == oldlist) && (ListIndexProlog[k] == *oldlist))
+            break;
+    if(k == LISTINDEXLISTS)
+        return;
+
+    for(n = 0; n < LISTINDEXLISTS; ++n)
+        if(!ListIndexList[n])
+            break;
+    if(n == LISTINDEXLISTS) {
+        n = ListIndexNext;
+        if(n == k)
+            n = (n + 1) % LISTINDEXLISTS;
+        ListIndexNext = (n + 1) % LISTINDEXLISTS;
+    }
+
+    src = ListIndexOffset + k * LISTINDEXSIZE;
+    dest = ListIndexOffset + n * LISTINDEXSIZE;
+    nentries =
+            (ListIndexCount[k] + (1 << ListIndexShift[k]) -
+            1) >> ListIndexShift[k];
+    for(j = 0; j < nentries; ++j)
+        dest[j] = ((j << ListIndexShift[k]) >=
+                position) ? src[j] + delta : src[j];
+
+    ListIndexList[n] = newlist;
+    ListIndexProlog[n] = *newlist;
+    ListIndexCount[n] = ListIndexCount[k];
+    ListIndexShift[n] = ListIndexShift[k];
+}
+
 BINT rplListLength(WORDPTR composite)
 {
     BINT count = 0;
+    BINT k = rplListIndexGet(composite);
+    if(k >= 0)
+        return ListIndexCount[k];
     WORDPTR ptr = composite + 1;
     WORDPTR end = composite + OBJSIZE(*composite);      // POINT TO THE END MARKER
     while(ptr < end) {
@@ -113,6 +231,20 @@ WORDPTR rplGetListElement(WORDPTR composite, BINT pos)
 {
     if(pos < 1)
         return 0;
+    BINT k = rplListIndexGet(composite);
+    if(k >= 0) {
+        // START FROM THE CLOSEST INDEXED ELEMENT
+        if(pos > ListIndexCount[k])
+            return 0;
+        --pos;
+        WORDPTR ptr =
+                composite + ListIndexOffset[k * LISTINDEXSIZE +
+                (pos >> ListIndexShift[k])];
+        pos &= (1 << ListIndexShift[k]) - 1;
+        while(pos--)
+            ptr = rplSkipOb(ptr);
+        return ptr;
+    }
     BINT count = 1;
     WORDPTR ptr = composite + 1;
     WORDPTR end = composite + OBJSIZE(*composite);      // POINT TO THE END MARKER
@@ -593,9 +725,33 @@ WORDPTR rplListReplace(WORDPTR list, BINT position, WORDPTR object)
     memmovew(newlist + oldobjoffset + newobjsize,
             ScratchPointer1 + oldobjoffset + oldobjsize,
             OBJSIZE(*ScratchPointer1) - (oldobjoffset + oldobjsize - 1));
+    rplListIndexDerive(ScratchPointer1, newlist, position,
+            newobjsize - oldobjsize);
     return newlist;
 }
 
+// REPLACE THE OBJECT AT position OF THE LIST AT *owner WITHOUT CREATING A NEW LIST
+// ONLY POSSIBLE WHEN THE NEW OBJECT HAS THE SAME SIZE AS THE OLD ONE, THE LIST
+// IS LARGE ENOUGH TO BE WORTH IT AND NOTHING BUT *owner REFERENCES THE LIST
+// RETURNS 1 IF THE LIST WAS MODIFIED, 0 IF A NEW LIST MUST BE CREATED
+// NEVER TRIGGERS GC. THE OFFSET INDEX OF THE LIST REMAINS VALID
+BINT rplListReplaceInPlace(WORDPTR * owner, BINT position, WORDPTR object)
+{
+    WORDPTR list = *owner;
+    if(!ISLIST(*list) || (OBJSIZE(*list) < LISTINPLACEMINSIZE))
+        return 0;
+    WORDPTR oldobject = rplGetListElement(list, position);
+    if(!oldobject)
+        return 0;
+    BINT objsize = rplObjSize(object);
+    if(rplObjSize(oldobject) != objsize)
+        return 0;
+    if(!rplIsSoleReference(owner))
+        return 0;
+    memmovew(oldobject, object, objsize);
+    return 1;
+}
+
 // CREATE A NEW LIST REPLACING MULTIPLE OBJECTS AT position WITH THE GIVEN object (IF A LIST, IT'S EXPLODED ON REPLACEMENT)
 // RETURNS POINTER TO NEW LIST, CAN TRIGGER GC.
 // USES SCRATCHPOINTERS 1 AND 2
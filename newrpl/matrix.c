@@ -13,6 +13,9 @@
 // INTERNAL USE ONLY
 #define GETELEMENT(matrix,index) ((matrix)+(matrix)[2+(index)])
 
+// BIT COUNT USED BY THE INTEGER LIBRARY TO DETECT OVERFLOW
+extern int rpl_log2(BINT64 number, int bits);
+
 // GET A POINTER TO AN OBJECT WITHIN THE MATRIX/VECTOR
 // RETURN 0 ON OUT-OF-RANGE
 // VECTORS ARE AUTO-ROTATED
@@ -177,6 +180,19 @@ WORDPTR *rplMatrixExplodeByCols()
     return matrix + 1;
 }
 
+// HASH ALL THE WORDS OF AN OBJECT (FNV-1a)
+static WORD rplMatrixHashObject(WORDPTR obj)
+{
+    WORD hash = 2166136261U;
+    BINT nwords = rplObjSize(obj);
+
+    while(nwords--) {
+        hash ^= *obj++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
 // COMPOSES A NEW MATRIX OBJECT FROM OBJECTS IN THE STACK STARTING AT level
 // OBJECTS MUST BE IN ROW-ORDER, level IS THE LAST OBJECT IN THE MATRIX (LOWEST NUMBER)
 // RETURNS 0 IF ERROR, AND SETS Exceptions AND ExceptionPtr.
@@ -214,28 +230,45 @@ WORDPTR rplMatrixComposeN(BINT level, BINT rows, BINT cols)
         totalsize += rplObjSize(obj);
     }
 
-    WORDPTR matrix = rplAllocTempOb(totalsize + 1 + totalelements);
-    WORDPTR newobj = matrix + 2 + totalelements;        // POINT TO THE NEXT OBJECT TO STORE
+// IDENTICAL ELEMENTS ARE STORED ONLY ONCE, FIND THEM THROUGH A HASH TABLE
+// THE TABLE IS KEPT AT THE END OF THE ALLOCATION AND RELEASED WHEN THE OBJECT IS TRUNCATED
+    BINT nbuckets = 1;
+    while(nbuckets < totalelements)
+        nbuckets <<= 1;
+
+    WORDPTR matrix =
+            rplAllocTempOb(totalsize + 1 + totalelements + nbuckets +
+            totalelements);
 
     if(!matrix)
         return 0;
 
+    WORDPTR newobj = matrix + 2 + totalelements;        // POINT TO THE NEXT OBJECT TO STORE
+    WORDPTR buckets = newobj + totalsize;       // FIRST ELEMENT+1 WITH EACH HASH, 0=NONE
+    WORDPTR chain = buckets + nbuckets; // NEXT ELEMENT+1 WITH THE SAME HASH
+    WORD hash;
+
+    for(k = 0; k < nbuckets; ++k)
+        buckets[k] = 0;
+
 // FINALLY, ASSEMBLE THE OBJECT
     for(k = 0; k < totalelements; ++k) {
         obj = rplPeekData(level - 1 + totalelements - k);
-        for(j = 0; j < k; ++j)
-            if(rplCompareObjects(obj,
-                        rplPeekData(level - 1 + totalelements - j)))
+        hash = rplMatrixHashObject(obj) & (nbuckets - 1);
+        for(j = buckets[hash]; j; j = chain[j - 1])
+            if(rplCompareObjects(obj, matrix + matrix[1 + j]))
                 break;
-        if(j != k) {
+        if(j) {
             // ADD THE ORIGINAL OBJECT
-            matrix[2 + k] = matrix[2 + j];
+            matrix[2 + k] = matrix[1 + j];
         }
         else {
             // ADD A NEW OBJECT
             matrix[2 + k] = newobj - matrix;
             rplCopyObject(newobj, obj);
             newobj = rplSkipOb(newobj);
+            chain[k] = buckets[hash];
+            buckets[hash] = k + 1;
         }
     }
 
@@ -253,6 +286,103 @@ WORDPTR rplMatrixCompose(BINT rows, BINT cols)
     return rplMatrixComposeN(1, rows, cols);
 }
 
+// CHECK IF AN OBJECT IS A REAL OR AN EXACT DECIMAL INTEGER
+// INTEGERS IN OTHER BASES KEEP THEIR BASE, SO THEY ARE LEFT TO THE OVERLOADED OPERATORS
+static BINT rplMatrixIsNumber(WORDPTR obj)
+{
+    return ISREAL(*obj) || (ISBINT(*obj) && (LIBNUM(*obj) == DECBINT));
+}
+
+// CHECK IF ALL ELEMENTS OF A MATRIX ARE REALS OR INTEGERS
+// SUCH MATRICES ARE OPERATED DIRECTLY ON THE NUMBERS, WITHOUT
+// DISPATCHING EVERY OPERATION THROUGH THE OVERLOADED OPERATORS
+static BINT rplMatrixIsReal(WORDPTR matrix, BINT totalelements)
+{
+    BINT j;
+    for(j = 0; j < totalelements; ++j)
+        if(!rplMatrixIsNumber(GETELEMENT(matrix, j)))
+            return 0;
+    return 1;
+}
+
+// APPLY ADD, SUB OR MUL TO TWO REALS, LEAVE THE RESULT IN RReg[0]
+// SAME RESULTS AND ERRORS AS THE OVERLOADED OPERATOR ON REAL OBJECTS
+// RETURN FALSE IF THERE WAS AN ERROR
+static BINT rplMatrixRealOp(WORD Opcode, REAL * x, REAL * y)
+{
+    switch (Opcode) {
+    case CMD_OVR_ADD:
+        if(!rplFastNumericBinary(FASTNUM_ADD, &RReg[0], x, y))
+            addReal(&RReg[0], x, y);
+        break;
+    case CMD_OVR_SUB:
+        if(!rplFastNumericBinary(FASTNUM_SUB, &RReg[0], x, y))
+            subReal(&RReg[0], x, y);
+        break;
+    default:
+        if(!rplFastNumericBinary(FASTNUM_MUL, &RReg[0], x, y))
+            mulReal(&RReg[0], x, y);
+        break;
+    }
+    rplCheckResultAndError(&RReg[0]);
+    return !Exceptions;
+}
+
+// APPLY ADD, SUB OR MUL TO TWO INTEGERS
+// RETURN FALSE IF THE INTEGER LIBRARY WOULD OVERFLOW TO A REAL, WITHOUT CHANGING *result
+static BINT rplMatrixIntOp(WORD Opcode, BINT64 x, BINT64 y, BINT64 * result)
+{
+    switch (Opcode) {
+    case CMD_OVR_SUB:
+        if(y == MIN_BINT)
+            return 0;
+        y = -y;
+        // DELIBERATE FALL THROUGH
+    case CMD_OVR_ADD:
+        if((x > 0) ? (y > MAX_BINT - x) : (y < MIN_BINT - x))
+            return 0;
+        *result = x + y;
+        return 1;
+    default:
+    {
+        BINT64 ax = (x < 0) ? -x : x, ay = (y < 0) ? -y : y;
+        if((x == MIN_BINT) || (y == MIN_BINT))
+            return 0;
+        if(ay > ax) {
+            BINT64 tmp = ax;
+            ax = ay;
+            ay = tmp;
+        }
+        if((ay >> 32) || (rpl_log2(ax, 64) + rpl_log2(ay, 32) >= 63))
+            return 0;
+        *result = x * y;
+        return 1;
+    }
+    }
+}
+
+// APPLY ADD, SUB OR MUL TO TWO ELEMENTS ACCEPTED BY rplMatrixIsNumber AND PUSH THE RESULT
+// INTEGERS STAY INTEGERS UNTIL THEY OVERFLOW, SAME AS THE OVERLOADED OPERATORS
+// RETURN FALSE IF THERE WAS AN ERROR
+static BINT rplMatrixNumberOp(WORD Opcode, WORDPTR x, WORDPTR y)
+{
+    REAL rx, ry;
+    BINT64 result;
+
+    if(ISBINT(*x) && ISBINT(*y)
+            && rplMatrixIntOp(Opcode, rplReadBINT(x), rplReadBINT(y),
+                &result)) {
+        rplNewBINTPush(result, DECBINT);
+        return !Exceptions;
+    }
+
+    rplReadNumberAsReal(x, &rx);
+    rplReadNumberAsReal(y, &ry);
+    if(rplMatrixRealOp(Opcode, &rx, &ry))
+        rplNewRealFromRRegPush(0);
+    return !Exceptions;
+}
+
 // APPLIES ANY OVERLOADABLE BINARY OPERATOR THAT WORKS ELEMENT-BY-ELEMENT (ADD/SUBTRACT)
 
 void rplMatrixBinary(WORD Opcode)
@@ -321,24 +451,38 @@ void rplMatrixBinary(WORD Opcode)
 
     BINT j;
 
-// DO THE ELEMENT-BY-ELEMENT OPERATION
-
-    for(j = 0; j < totalelements; ++j) {
-        rplPushData(GETELEMENT(*a, j));
-        rplPushData(GETELEMENT(*b, j));
-        rplCallOperator(Opcode);
-        if(Exceptions) {
-            DSTop = Savestk;
-            return;
+    if(((Opcode == CMD_OVR_ADD) || (Opcode == CMD_OVR_SUB)
+                || (Opcode == CMD_OVR_MUL))
+            && rplMatrixIsReal(*a, totalelements)
+            && rplMatrixIsReal(*b, totalelements)) {
+        // ALL NUMBERS, OPERATE DIRECTLY ON THEM
+        for(j = 0; j < totalelements; ++j) {
+            if(!rplMatrixNumberOp(Opcode, GETELEMENT(*a, j), GETELEMENT(*b,
+                            j))) {
+                DSTop = Savestk;
+                return;
+            }
         }
-        if(ISSYMBOLIC(*rplPeekData(1))) {
-            rplSymbAutoSimplify();
+    }
+    else {
+        // DO THE ELEMENT-BY-ELEMENT OPERATION
+        for(j = 0; j < totalelements; ++j) {
+            rplPushData(GETELEMENT(*a, j));
+            rplPushData(GETELEMENT(*b, j));
+            rplCallOperator(Opcode);
             if(Exceptions) {
                 DSTop = Savestk;
                 return;
             }
-        }
+            if(ISSYMBOLIC(*rplPeekData(1))) {
+                rplSymbAutoSimplify();
+                if(Exceptions) {
+                    DSTop = Savestk;
+                    return;
+                }
+            }
 
+        }
     }
 
     WORDPTR newmat = rplMatrixCompose(rowsa, colsa);
@@ -390,24 +534,34 @@ void rplMatrixMulScalar()
 
     BINT j;
 
-// DO THE ELEMENT-BY-ELEMENT OPERATION
-
-    for(j = 0; j < totalelements; ++j) {
-        rplPushData(GETELEMENT(*a, j));
-        rplPushData(*b);
-        rplCallOvrOperator((CMD_OVR_MUL));
-        if(Exceptions) {
-            DSTop = Savestk;
-            return;
+    if(rplMatrixIsNumber(*b) && rplMatrixIsReal(*a, totalelements)) {
+        // ALL NUMBERS, OPERATE DIRECTLY ON THEM
+        for(j = 0; j < totalelements; ++j) {
+            if(!rplMatrixNumberOp(CMD_OVR_MUL, GETELEMENT(*a, j), *b)) {
+                DSTop = Savestk;
+                return;
+            }
         }
-        if(ISSYMBOLIC(*rplPeekData(1))) {
-            rplSymbAutoSimplify();
+    }
+    else {
+        // DO THE ELEMENT-BY-ELEMENT OPERATION
+        for(j = 0; j < totalelements; ++j) {
+            rplPushData(GETELEMENT(*a, j));
+            rplPushData(*b);
+            rplCallOvrOperator((CMD_OVR_MUL));
             if(Exceptions) {
                 DSTop = Savestk;
                 return;
             }
-        }
+            if(ISSYMBOLIC(*rplPeekData(1))) {
+                rplSymbAutoSimplify();
+                if(Exceptions) {
+                    DSTop = Savestk;
+                    return;
+                }
+            }
 
+        }
     }
 
     WORDPTR newmat = rplMatrixCompose(rowsa, colsa);
@@ -650,37 +804,104 @@ void rplMatrixMul()
 
     BINT i, j, k;
 
-    for(i = 0; i < rowsa; ++i) {
-
-        for(j = 0; j < colsb; ++j) {
-            for(k = 0; k < colsa; ++k) {
-                rplPushData(GETELEMENT(*a, i * colsa + k));
-                rplPushData(GETELEMENT(*b, k * colsb + j));
-                rplCallOvrOperator((CMD_OVR_MUL));
+    if(rplMatrixIsReal(*a, rowsa * colsa)
+            && rplMatrixIsReal(*b, rowsb * colsb)) {
+        // ALL NUMBERS, ACCUMULATE EACH DOT PRODUCT DIRECTLY ON THEM
+        // ROUNDING IS DONE AFTER EVERY OPERATION, SAME AS THE GENERAL CASE
+        // INTEGER PARTIAL RESULTS ARE KEPT AS INTEGERS UNTIL THEY OVERFLOW OR MEET A REAL
+        REAL x, y;
+        WORDPTR ea, eb;
+        BINT64 iacc = 0, iprod = 0;
+        BINT accint = 0, prodint;
+
+        for(i = 0; i < rowsa; ++i) {
+            for(j = 0; j < colsb; ++j) {
+                for(k = 0; k < colsa; ++k) {
+                    ea = GETELEMENT(*a, i * colsa + k);
+                    eb = GETELEMENT(*b, k * colsb + j);
+                    prodint = ISBINT(*ea) && ISBINT(*eb)
+                            && rplMatrixIntOp(CMD_OVR_MUL, rplReadBINT(ea),
+                            rplReadBINT(eb), &iprod);
+                    if(!prodint) {
+                        rplReadNumberAsReal(ea, &x);
+                        rplReadNumberAsReal(eb, &y);
+                        if(!rplMatrixRealOp(CMD_OVR_MUL, &x, &y)) {
+                            DSTop = Savestk;
+                            return;
+                        }
+                        // KEEP ONLY THE FLAGS A REAL OBJECT WOULD STORE
+                        RReg[0].flags &= 0xf;
+                    }
+                    if(!k) {
+                        if(prodint)
+                            iacc = iprod;
+                        else
+                            swapReal(&RReg[0], &RReg[1]);
+                        accint = prodint;
+                        continue;
+                    }
+                    if(accint && prodint
+                            && rplMatrixIntOp(CMD_OVR_ADD, iacc, iprod, &iacc))
+                        continue;
+                    // ADD AS REALS
+                    if(prodint)
+                        rplBINTToRReg(2, iprod);
+                    else
+                        swapReal(&RReg[0], &RReg[2]);
+                    if(accint)
+                        rplBINTToRReg(1, iacc);
+                    if(!rplMatrixRealOp(CMD_OVR_ADD, &RReg[1], &RReg[2])) {
+                        DSTop = Savestk;
+                        return;
+                    }
+                    RReg[0].flags &= 0xf;
+                    swapReal(&RReg[0], &RReg[1]);
+                    accint = 0;
+                }
+                if(accint)
+                    rplNewBINTPush(iacc, DECBINT);
+                else
+                    rplNewRealFromRRegPush(1);
                 if(Exceptions) {
-                    // CLEAN UP THE STACK AND RETURN
                     DSTop = Savestk;
                     return;
                 }
-                if(k) {
-                    rplCallOvrOperator((CMD_OVR_ADD));
+            }
+        }
+    }
+    else {
+        for(i = 0; i < rowsa; ++i) {
+
+            for(j = 0; j < colsb; ++j) {
+                for(k = 0; k < colsa; ++k) {
+                    rplPushData(GETELEMENT(*a, i * colsa + k));
+                    rplPushData(GETELEMENT(*b, k * colsb + j));
+                    rplCallOvrOperator((CMD_OVR_MUL));
                     if(Exceptions) {
                         // CLEAN UP THE STACK AND RETURN
                         DSTop = Savestk;
                         return;
                     }
+                    if(k) {
+                        rplCallOvrOperator((CMD_OVR_ADD));
+                        if(Exceptions) {
+                            // CLEAN UP THE STACK AND RETURN
+                            DSTop = Savestk;
+                            return;
+                        }
+                    }
                 }
-            }
-            if(ISSYMBOLIC(*rplPeekData(1))) {
-                rplSymbAutoSimplify();
-                if(Exceptions) {
-                    DSTop = Savestk;
-                    return;
+                if(ISSYMBOLIC(*rplPeekData(1))) {
+                    rplSymbAutoSimplify();
+                    if(Exceptions) {
+                        DSTop = Savestk;
+                        return;
+                    }
                 }
+
             }
 
         }
-
     }
 
     // HERE WE HAVE ALL THE ELEMENTS IN ROW ORDER
@@ -16,7 +16,7 @@ __ARM_MODE__ void mul_real_arm(BINT * rdata, BINT * adata, BINT * bdata,
 
     // INITIALIZE END POINTERS
 
-    asm volatile ("mov r14,#0xab000000");       // r14 = 2882303762
+    asm volatile ("mov r14,#0xab000000");       // r14 = 2882303761 (2^58/10^8 ROUNDED DOWN)
     asm volatile ("mov r11,r3,lsr #16");        // R11=alen
     asm volatile ("mov r4,#0"); // R4 = i
     asm volatile ("orr r14,r14,#0xcc0000");
@@ -27,7 +27,7 @@ __ARM_MODE__ void mul_real_arm(BINT * rdata, BINT * adata, BINT * bdata,
     asm volatile ("orr r12,r12,#0xa1000");
     asm volatile ("orr r14,r14,#0x7700");
     asm volatile ("orr r12,r12,#0xf00");
-    asm volatile ("orr r14,r14,#0x12");
+    asm volatile ("orr r14,r14,#0x11");
 
     asm volatile (".Lloop_i:");
 
@@ -43,7 +43,7 @@ __ARM_MODE__ void mul_real_arm(BINT * rdata, BINT * adata, BINT * bdata,
     asm volatile ("umull r8,r9,r6,r7"); // a->data[j]*b->data[i]
     asm volatile ("mov r9,r9,lsl #6");
     asm volatile ("orr r9,r8,lsr #26");
-    asm volatile ("umull r6,r9,r14,r9");        //  R9=hi32_1=(((tmp1.w32[1]<<6)|(tmp1.w32[0]>>26))*2882303762ULL)>>32;
+    asm volatile ("umull r6,r9,r14,r9");        //  R9=hi32_1=(((tmp1.w32[1]<<6)|(tmp1.w32[0]>>26))*2882303761ULL)>>32;
     asm volatile ("mla r8,r9,r12,r8");  //  R8=lo32_1=tmp1.w+hi32_1*4194967296U;
     asm volatile ("ldmia r0,{r3,r6}");
     asm volatile ("add r8,r8,r3");
@@ -158,7 +158,7 @@ __ARM_MODE__ void mul_real_arm(BINT * rdata, BINT * adata, BINT * bdata,
        // UNROLLED add_single64()
        // NUMBER IS GUARANTEED TO BE POSITIVE
        tmp1.w=a->data[j]*(UBINT64)b->data[i];
-       hi32_1=(((tmp1.w32[1]<<6)|(tmp1.w32[0]>>26))*2882303762ULL)>>32;
+       hi32_1=(((tmp1.w32[1]<<6)|(tmp1.w32[0]>>26))*2882303761ULL)>>32;
        lo32_1=tmp1.w+hi32_1*4194967296U;
        result->data[i+j]+=lo32_1;
        result->data[i+j+1]+=hi32_1;
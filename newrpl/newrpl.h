@@ -49,6 +49,22 @@ extern "C"
         };
     } REAL_HEADER;
 
+// BINARY BIG INTEGERS FOR EXACT INTEGER WORK
+// MAGNITUDE IN 32-BIT WORDS, LEAST SIGNIFICANT FIRST, len==0 MEANS ZERO
+// STORAGE IS EITHER A DECIMAL REGISTER FROM allocRegister() OR THE
+// PAYLOAD OF A BIGINT OBJECT IN TEMPOB
+// BIGINT_MAXWORDS IS CHOSEN SO ANY REGISTER BIGINT CONVERTS BACK TO A REAL REGISTER
+
+#define BIGINT_MAXWORDS ((REAL_REGISTER_STORAGE*4)/5)
+
+    typedef struct
+    {
+        WORD *data;
+        BINT len;
+        BINT maxlen;    // WORDS OF STORAGE AVAILABLE IN data
+        BINT flags;     // ONLY F_NEGATIVE IS USED
+    } BIGINT;
+
 // COMPACT TIME STRUCTURE - 32 BITS.
 struct time
 {
@@ -183,6 +199,12 @@ struct date
     void rplCompileInsert(WORDPTR position, WORD word);
     WORDPTR rplCompileAppendWords(BINT nwords);
     void rplCompileRemoveWords(BINT nwords);
+    void rplClearCmdIndex();
+    void rplAddCmdIndex(BINT libnum, char *libnames[], BINT numcmds);
+    void rplRemoveCmdIndex(BINT libnum);
+    void rplUpdateCompileProbeLibs();
+    BINT rplFindCmdIndex(BYTEPTR start, BYTEPTR end, BINT * libs,
+            BINT maxlibs);
 
 #define DECOMP_EMBEDDED     1
 #define DECOMP_EDIT         2
@@ -251,6 +273,7 @@ struct date
     BINT rplTestSystemFlag(BINT flag);
     BINT rplTestSystemFlagByName(BYTEPTR name, BYTEPTR nameend);
     BINT rplTestSystemFlagByIdent(WORDPTR ident);
+    void rplGetSystemFlagsSettings(WORD * settings);
 
 // USER FLAGS
     BINT rplSetUserFlag(BINT flag);
@@ -283,6 +306,9 @@ struct date
 
 // GARBAGE COLLECTION
     void rplGCollect();
+    void rplGCollectMinor();
+    void rplGCResetGenerations();
+    BINT rplIsSoleReference(WORDPTR * owner);
 
 // BACKUP/RESTORE
     BINT rplBackup(int (*writefunc)(unsigned int, void *), void *OpaqueArg);
@@ -326,6 +352,8 @@ struct date
     void rplClearLAMs();
     WORDPTR *rplFindLAM(WORDPTR nameobj, BINT scanparents);
     WORDPTR *rplFindLAMbyName(BYTEPTR name, BINT len, BINT scanparents);
+    WORDPTR *rplFindIdentCached(WORDPTR ident);
+    void rplInvalidateIdentCache();
     WORDPTR *rplGetNextLAMEnv(WORDPTR * startpoint);
     BINT rplNeedNewLAMEnv();
     BINT rplNeedNewLAMEnvCompiler();
@@ -389,6 +417,9 @@ struct date
     WORDPTR *rplDeepCopyDir(WORDPTR * sourcedir);
     void rplWipeDir(WORDPTR * directory);
     void rplPurgeForced(WORDPTR * var);
+// HASH INDEX OF LARGE DIRECTORIES
+    void rplInvalidateDirIndex(WORDPTR * directory);
+    void rplClearDirIndex();
 
 // FUNCTIONS SPECIFIC FOR THE .Settings DIRECTORY
     void rplPurgeSettings(WORDPTR nameobj);
@@ -404,6 +435,8 @@ struct date
 
 // SOLVERS AUXILIARY FUNCTIONS
     void rplEvalUserFunc(WORDPTR arg_userfunc, WORD Opcode);
+    WORDPTR rplAsmCompileUserFunc(WORDPTR userfunc);
+    void rplAsmRunCode(WORDPTR code);
     void rplEvalMultiUserFunc(WORDPTR * listofeq, WORDPTR * listofvars,
             BINT nvars, BINT minimizer);
 
@@ -423,6 +456,30 @@ struct date
     WORDPTR rplWriteBINT(BINT64 num, int base, WORDPTR dest);
     void rplCompileBINT(BINT64 num, int base);
 
+// BIG INTEGER FUNCTIONS
+    BINT allocBigInt(BIGINT * a);
+    void freeBigInt(BIGINT * a);
+    void copyBigInt(BIGINT * dest, BIGINT * src);
+    void swapBigInt(BIGINT * a, BIGINT * b);
+    void newBigIntFromBINT64(BIGINT * result, BINT64 value);
+    BINT newBigIntFromReal(BIGINT * result, REAL * number);
+    void newRealFromBigInt(REAL * result, BIGINT * a);
+    BINT cmpBigInt(BIGINT * a, BIGINT * b);
+    BINT addBigInt(BIGINT * result, BIGINT * a, BIGINT * b);
+    BINT subBigInt(BIGINT * result, BIGINT * a, BIGINT * b);
+    BINT mulBigInt(BIGINT * result, BIGINT * a, BIGINT * b);
+    BINT divmodBigInt(BIGINT * quotient, BIGINT * a, BIGINT * b);
+    BINT mulmodBigInt(BIGINT * result, BIGINT * a, BIGINT * b,
+            BIGINT * mod, BIGINT * tmp);
+    BINT powmodBigInt(BIGINT * result, BIGINT * a, BIGINT * b,
+            BIGINT * mod);
+    void gcdBigInt(BIGINT * a, BIGINT * b);
+    BINT factorialBigInt(BIGINT * result, BINT n);
+
+// BIGINT OBJECT FUNCTIONS
+    void rplLoadBigIntAsReal(WORDPTR number, REAL * dec);
+    void rplNewFactorialPush(BINT n);
+
 // TRUE/FALSE FUNCTIONS
     void rplPushFalse();
     void rplPushTrue();
@@ -450,6 +507,10 @@ struct date
     void rplCheckResultAndError(REAL * real);
     void rplCompileReal(REAL * num);
 
+// FAST NUMERIC MODE
+    BINT rplFastNumericBinary(BINT op, REAL * result, REAL * a, REAL * b);
+    BINT rplFastNumericUnary(BINT op, REAL * result, REAL * x, BINT angmode);
+
 // COMPLEX FUNCTIONS
     void rplRealPart(WORDPTR complex, REAL * real);
     void rplImaginaryPart(WORDPTR complex, REAL * imag);
@@ -510,6 +571,8 @@ struct date
     void rplUnitReverseReplaceSpecial2(BINT isspec_idx);
     void rplUnitSpecialToDelta(BINT nlevels);
     WORDPTR *rplUnitFindCustom(WORDPTR ident, BINT * siindex);
+    void rplUnitBuildIndex();
+    void rplUnitClearCache();
     void rplUnitUnaryDoCmd();
     BINT rplUnitIsNonDimensional(WORDPTR uobject);
     void rplUnitUnaryDoCmdNonDimensional();
@@ -537,6 +600,9 @@ struct date
     WORDPTR rplListAddRot(WORDPTR list, WORDPTR object, BINT nmax);
     WORDPTR rplListReplace(WORDPTR list, BINT position, WORDPTR object);
     WORDPTR rplListReplaceMulti(WORDPTR list, BINT position, WORDPTR object);
+    BINT rplListReplaceInPlace(WORDPTR * owner, BINT position, WORDPTR object);
+    void rplClearListIndex();
+    void rplReleaseListIndex(WORDPTR limit);
     void rplListExpandCases();
     BINT rplListHasLists(WORDPTR list);
 
@@ -550,12 +616,22 @@ struct date
     BINT rplSymbGetTokenInfo(WORDPTR object);
     void rplSymbApplyOperator(WORD Opcode, BINT nargs);
     BINT rplSymbRuleMatch();
+    BINT rplSymbRuleMatchCanonical();
+    BINT rplSymbRuleCanMatch(WORDPTR rule, WORD * ops, BINT nops);
+    BINT rplSymbCollectOperators(WORDPTR symbolic, WORD * ops, BINT maxops);
     BINT rplSymbGetAttr(WORDPTR object);
     WORDPTR rplComplexToSymb(WORDPTR complex);
 
     void rplSymbRuleApply();
     BINT rplSymbIsRule(WORDPTR ptr);
     void rplSymbAutoSimplify();
+    void rplClearSymbCache();
+    void rplClearSymbCacheKind(BINT kind);
+    void rplReleaseSymbCache(WORDPTR limit);
+    WORDPTR rplSymbCacheFind(WORDPTR object, BINT kind, WORD * hash);
+    void rplSymbCacheStore(WORDPTR object, BINT kind, WORD hash,
+            WORDPTR result);
+    BINT rplSymbIsCacheable(WORDPTR ptr);
     WORDPTR rplSymbNumericReduce(WORDPTR object);
     BINT rplSymbIsNumeric(WORDPTR ptr);
     BINT rplSymbIsZero(WORDPTR ptr);
@@ -569,6 +645,7 @@ struct date
     BINT rplSymbExplode(WORDPTR object);
     WORDPTR rplSymbImplode(WORDPTR * exprstart);
     WORDPTR rplSymbCanonicalForm(WORDPTR object, BINT fordisplay);
+    WORDPTR rplSymbCanonicalFormNoCache(WORDPTR object, BINT fordisplay);
     BINT rplSymbExplodeOneLevel(WORDPTR object);
     WORDPTR rplSymbReplaceVar(WORDPTR symb, WORDPTR findvar, WORDPTR newvar);
 
@@ -767,6 +844,7 @@ struct date
 
 #define FL_LISTCMDCLEANUP -48   // INTERNAL USE: LIST COMMANDS DO ADDITIONAL CLEANUP ON ERRORS
 #define FL_FORCED_RAD     -49   // INTERNAL USE: COMMANDS THAT TAKE ANGLES AS ARGUMENTS NEED TO INTERPRET REALS AS RADIANS
+#define FL_FASTNUMERIC    -50   // SET TO COMPUTE WITH APPROXIMATED REALS IN BINARY FLOATING POINT (FASTNUM_DIGITS)
 
 #define FL_ERRORBEEP      -56
 #define FL_ALARMBEEP      -57
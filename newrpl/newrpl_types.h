@@ -36,6 +36,8 @@ typedef uint32_t PTR2NUMBER;
 #define REAL_REGISTERS 10
 // NUMBER OF SIMULTANEOUS CONVERSIONS OF BINT TO REALS THAT CAN BE DONE
 #define BINT2REAL      16
+// NUMBER OF SIMULTANEOUS CONVERSIONS OF BIGINT TO REALS THAT CAN BE DONE
+#define BIGINT2REAL    4
 
 // MAXIMUM PRECISION ALLOWED IN THE SYSTEM
 // MAKE SURE REAL_SCRATCHMEM CAN HAVE AT LEAST "REAL_REGISTERS*PRECISION_MAX*2/9" WORDS
@@ -51,6 +53,8 @@ typedef uint32_t PTR2NUMBER;
 #define REAL_REGISTER_STORAGE ((REAL_PRECISION_MAX*3)/8+3)
 #define BINT_REGISTER_STORAGE  3
 #define EXTRA_STORAGE BINT2REAL*BINT_REGISTER_STORAGE
+#define BIGINT_REGISTER_STORAGE (REAL_PRECISION_MAX/8+2)
+#define BIGINT_EXTRA_STORAGE BIGINT2REAL*BIGINT_REGISTER_STORAGE
 
 // DEFINE THE LIMITS FOR THE EXPONENT RANGE FOR ALL REALS
 // NOTE: THIS HAS TO FIT WITHIN THE FIELDS OF REAL_HEADER
@@ -63,6 +67,38 @@ typedef uint32_t PTR2NUMBER;
 #define MAXLOWLIBS 256
 #define MAXSYSHILIBS 16
 #define MAXLIBNUMBER 4095
+// NUMBER OF LIBRARY NUMBERS AVAILABLE TO USER LIBRARIES (BETWEEN LOW AND SYSTEM HIGH LIBS)
+#define MAXUSERLIBNUMBER (MAXLIBNUMBER + 1 - MAXSYSHILIBS - MAXLOWLIBS)
+// COMMAND NAME INDEX USED BY THE COMPILER
+// COMMANDS THAT DON'T FIT IN THE INDEX ARE FOUND BY PROBING THEIR LIBRARY
+#define MAXCMDINDEX     512
+#define CMDINDEXBUCKETS 256     // MUST BE A POWER OF 2
+// NUMBER OF MOVED BLOCKS THE GARBAGE COLLECTOR PATCHES IN A SINGLE PASS
+#define GCRELOCSIZE 128
+// NUMBER OF MINOR COLLECTIONS AN OBJECT SURVIVES BEFORE IT'S PROMOTED TO THE OLD GENERATION
+#define GCPROMOTEAGE 2
+// HASH INDEX FOR GLOBAL VARIABLE LOOKUP IN LARGE DIRECTORIES
+#define DIRINDEXDIRS    4       // NUMBER OF DIRECTORIES INDEXED AT ONCE
+#define DIRINDEXSIZE    4096    // TOTAL SLOTS SHARED BY ALL INDEXED DIRECTORIES
+#define DIRINDEXMINVARS 16      // SMALLER DIRECTORIES ARE SCANNED LINEARLY
+// NUMBER OF CALL SITES REMEMBERED BY THE IDENT EVALUATION CACHE (MUST BE A POWER OF 2)
+#define IDENTCACHESIZE  64
+// ELEMENT OFFSET INDEX FOR RANDOM ACCESS INTO LARGE LISTS
+#define LISTINDEXLISTS  4       // NUMBER OF LISTS INDEXED AT ONCE
+#define LISTINDEXSIZE   128     // OFFSETS STORED PER LIST, LONGER LISTS STORE ONE EVERY 2^n ELEMENTS
+#define LISTINDEXMINSIZE 64     // SMALLER LISTS (IN WORDS) ARE SCANNED LINEARLY
+#define LISTINPLACEMINSIZE 256  // SMALLER LISTS (IN WORDS) ARE ALWAYS COPIED BY PUT
+// NUMBER OF SYMBOLICS REMEMBERED BY THE CANONICAL FORM CACHE (MUST BE A POWER OF 2)
+#define SYMBCACHESIZE   64
+// KINDS OF FORMS KEPT IN THE CACHE
+#define SYMBCACHE_CANONICAL     0
+#define SYMBCACHE_DISPLAY       1
+#define SYMBCACHE_SIMPLIFIED    2
+#define SYMBCACHE_AUTOSIMPLIFY  3
+#define SYMBCACHE_COMPILED      4
+#define SYMBCACHE_UNITBASE      5
+// HASH INDEX OF THE NAMES OF ALL SYSTEM UNITS (MUST BE A POWER OF 2, OVER TWICE THE NUMBER OF UNITS)
+#define UNITINDEXSIZE   512
 // NUMBER OF SCRATCH POINTERS
 #define MAX_GC_PTRUPDATE 38
 
@@ -24,8 +24,12 @@ void growRStk(WORD newtotalsize)
         newrstk = halGrowMemory(MEM_AREA_RSTK, RStk, newtotalsize);
 
         if(!newrstk) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                if(gc_done)
+                    rplGCollect();
+                else
+                    rplGCollectMinor();
                 ++gc_done;
             }
             else {
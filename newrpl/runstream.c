@@ -19,8 +19,19 @@ extern const WORD dotsettings_ident[];
 extern const WORD flags_ident[];
 extern const WORD bkpoint_seco[];
 
+// REBUILD THE INDEX OF USER LIBRARY NUMBERS INTO HiLibRegistry
+// MUST BE CALLED EVERY TIME THE SORTED LIST OF USER LIBRARIES CHANGES
+static void rplUpdateHiLibIndex()
+{
+    BINT k;
+    for(k = 0; k < MAXUSERLIBNUMBER; ++k)
+        HiLibIndex[k] = 0;
+    for(k = 0; k < NumHiLibs; ++k)
+        HiLibIndex[HiLibNumbers[k] - MAXLOWLIBS] = k + 1;
+}
+
 // GET A HANDLER FOR A LIBRARY
-// IT'S FAST FOR SYSTEM LIBRARIES, MUCH SLOWER FOR USER LIBS
+// SYSTEM LIBRARIES ARE IN THE REGISTRIES, USER LIBS GO THROUGH HiLibIndex
 
 LIBHANDLER rplGetLibHandler(BINT libnum)
 {
@@ -28,22 +39,9 @@ LIBHANDLER rplGetLibHandler(BINT libnum)
         return LowLibRegistry[libnum];
     if(libnum > MAXLIBNUMBER - MAXSYSHILIBS)
         return SysHiLibRegistry[libnum - (MAXLIBNUMBER + 1 - MAXSYSHILIBS)];
-    // DO A BINARY SEARCH FOR USER FUNCTIONS OTHERWISE
-    BINT lo = 0;
-    BINT hi = NumHiLibs - 1;
-    BINT x;
-    do {
-        x = (hi + lo) / 2;
-        if(HiLibNumbers[x] == libnum)
-            return HiLibRegistry[x];
-        if(HiLibNumbers[x] > libnum)
-            hi = x;
-        else
-            lo = x;
-    }
-    while(hi - lo > 1);
-    if(HiLibNumbers[hi] == libnum)
-        return HiLibRegistry[hi];
+    BINT idx = HiLibIndex[libnum - MAXLOWLIBS];
+    if(idx)
+        return HiLibRegistry[idx - 1];
 
     // LIBRARY NOT FOUND
     // DO NOT THROW AN EXCEPTION
@@ -127,6 +125,9 @@ void rplClearLibraries()
         HiLibNumbers[count] = 0;
     }
     NumHiLibs = 0;
+    rplUpdateHiLibIndex();
+
+    rplClearCmdIndex();
 
 }
 
@@ -141,21 +142,27 @@ void rplInstallCoreLibraries()
 
 }
 
-// INSTALL A LIBRARY HANDLER, RETURN 1 ON SUCCESS, 0 ON FAILURE
+// REGISTER A LIBRARY HANDLER WITH ALL ITS LIBRARY NUMBERS
+// RETURN 1 ON SUCCESS, 0 ON FAILURE
+// ALSO RETURNS THE LIST OF NUMBERS AND COMMAND NAMES REPORTED BY THE LIBRARY
 
-BINT rplInstallLibrary(LIBHANDLER handler)
+static BINT rplRegisterLibrary(LIBHANDLER handler, HALFWORD ** numbers,
+        char ***cmdnames, BINT * numcmds)
 {
     HALFWORD *listnumbers;
 
-    if(!handler)
-        return 0;
     WORD savedOpcode = CurOpcode;
     CurOpcode = OPCODE_LIBINSTALL;
     RetNum = -1;
+    LibraryCmdNames = 0;
+    LibraryNumCmds = 0;
     (*handler) ();      // CALL THE HANDLER TO GET THE LIBRARY NUMBER IN RetNum;
     CurOpcode = savedOpcode;
     if(RetNum == OK_CONTINUE) {
         listnumbers = (HALFWORD *) LibraryList;
+        *numbers = listnumbers;
+        *cmdnames = (char **)LibraryCmdNames;
+        *numcmds = LibraryNumCmds;
         while((*listnumbers) || (listnumbers == (HALFWORD *) LibraryList)) {
 
             if(*listnumbers < MAXLOWLIBS) {
@@ -226,6 +233,7 @@ BINT rplInstallLibrary(LIBHANDLER handler)
             *ptr = *listnumbers;
             *libptr = handler;
             ++NumHiLibs;
+            rplUpdateHiLibIndex();
             ++listnumbers;
             continue;
         }
@@ -236,10 +244,33 @@ BINT rplInstallLibrary(LIBHANDLER handler)
         return 0;       // HANDLER FAILED TO REPORT ANY LIBRARY NUMBERS
 }
 
-void rplRemoveLibrary(BINT number)
+// INSTALL A LIBRARY HANDLER, RETURN 1 ON SUCCESS, 0 ON FAILURE
+
+BINT rplInstallLibrary(LIBHANDLER handler)
+{
+    HALFWORD *numbers = 0;
+    char **cmdnames = 0;
+    BINT numcmds = 0, result;
+
+    if(!handler)
+        return 0;
+
+    result = rplRegisterLibrary(handler, &numbers, &cmdnames, &numcmds);
+
+    // ADD THE COMMANDS TO THE COMPILER INDEX
+    // ONLY LIBRARIES WITH A SINGLE NUMBER CAN BE INDEXED, OTHERWISE THE
+    // ORDER IN WHICH LIBRARIES ARE OFFERED THE TOKEN WOULD CHANGE
+    if(result && cmdnames && !numbers[1])
+        rplAddCmdIndex(numbers[0], cmdnames, numcmds);
+
+    rplUpdateCompileProbeLibs();
+
+    return result;
+}
+
+// UNREGISTER ALL LIBRARY NUMBERS OF THE LIBRARY THAT OWNS THE GIVEN NUMBER
+static void rplUnregisterLibrary(BINT number)
 {
-    if(number < 0 || number > MAXLIBNUMBER)
-        return;
     if(number < MAXLOWLIBS) {
         LIBHANDLER han = LowLibRegistry[number];
         // REMOVE ALL LIBRARIES REGISTERED WITH THAT SAME HANDLE
@@ -286,6 +317,8 @@ void rplRemoveLibrary(BINT number)
     while(ptr < HiLibNumbers + NumHiLibs) {
         if(*libptr == han) {
             ++found;
+            ++ptr;
+            ++libptr;
             continue;
         }
         ptr[-found] = *ptr;
@@ -294,6 +327,290 @@ void rplRemoveLibrary(BINT number)
         ++libptr;
     }
     NumHiLibs -= found;
+    rplUpdateHiLibIndex();
+}
+
+void rplRemoveLibrary(BINT number)
+{
+    if(number < 0 || number > MAXLIBNUMBER)
+        return;
+
+    rplUnregisterLibrary(number);
+
+    // ONLY SINGLE-NUMBER LIBRARIES ARE INDEXED, SO THIS IS THE ONLY ENTRY
+    rplRemoveCmdIndex(number);
+    rplUpdateCompileProbeLibs();
+}
+
+// RESULT CODES OF rplRunException(), OTHER THAN THE ONES RETURNED BY rplRun()
+#define RUN_NEXTOPCODE  -1      // BREAKPOINT CONSUMED, SKIP TO NEXT OPCODE
+#define RUN_TRAPPED     -2      // EXCEPTION TRAPPED BY AN ERROR HANDLER, KEEP RUNNING
+
+// PROCESS EXCEPTIONS AND HARDWARE BREAKPOINTS RAISED BY THE LAST OPCODE
+// KEPT OUT OF rplRun() SO THE INNER LOOP IS A SINGLE FLAG TEST IN THE COMMON CASE
+static BINT rplRunException(void)
+{
+    Exceptions |= HWExceptions; // COPY HARDWARE EXCEPTIONS INTO EXCEPTIONS AT THIS POINT TO AVOID
+    // STOPPING IN THE MIDDLE OF A COMMAND
+
+    if(HWExceptions)
+        HWExceptions &= EX_HWBKPOINT;       // CLEAR ANY EXCEPTIONS EXCEPT CHECK FOR BREAKPOINTS
+
+    if(Exceptions & EX_HWBKPOINT) {
+        if(!HaltedIPtr && !(Exceptions & ~(EX_HWBKPOINT | EX_HWBKPTSKIP)))  // MAKE SURE WE DON'T HALT ALREADY HALTED CODE OR INTERFERE WITH OTHER EXCEPTIONS
+        {
+            // CHECK FOR BREAKPOINT TRIGGERS!
+            int trigger = 0;
+            if(GET_BKPOINTFLAG(0) & BKPT_ENABLED) {
+                if(GET_BKPOINTFLAG(0) & BKPT_LOCATION) {
+                    WORDPTR nextopcode =
+                            IPtr + 1 +
+                            ((ISPROLOG(CurOpcode)) ?
+                            OBJSIZE(CurOpcode) : 0);
+                    if((nextopcode >= BreakPt1Pointer)
+                            && (nextopcode <
+                                rplSkipOb(BreakPt1Pointer))) {
+                        if(!(Exceptions & EX_HWBKPTSKIP))
+                            trigger = 1;
+                    }
+                }
+                else if(!(Exceptions & EX_HWBKPTSKIP))
+                    trigger = 1;
+
+                if(trigger) {
+                    if(GET_BKPOINTFLAG(0) & BKPT_COND) {
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
+                        BreakPtFlags |= BKPT_ALLPAUSED;
+
+                        // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
+
+                        rplPushDataNoGrow(BreakPt1Arg);
+                        IPtr = (WORDPTR) bkpoint_seco;
+                        CurOpcode = 0;
+                        Exceptions = 0;     //    CLEAR ERRORS AND GO...
+
+                    }
+                    else {
+
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        Exceptions = EX_HALT;
+
+                    }
+
+                }
+            }
+
+            // TODO: ADD SAME CODE FOR BREKPOINTS 1 AND 2 HERE
+
+            if(!trigger && (GET_BKPOINTFLAG(1) & BKPT_ENABLED)) {
+                if(GET_BKPOINTFLAG(1) & BKPT_LOCATION) {
+                    WORDPTR nextopcode =
+                            IPtr + 1 +
+                            ((ISPROLOG(CurOpcode)) ?
+                            OBJSIZE(CurOpcode) : 0);
+                    if((nextopcode >= BreakPt2Pointer)
+                            && (nextopcode <
+                                rplSkipOb(BreakPt2Pointer))) {
+                        if(!(Exceptions & EX_HWBKPTSKIP))
+                            trigger = 1;
+                    }
+                }
+                else if(!(Exceptions & EX_HWBKPTSKIP))
+                    trigger = 1;
+
+                if(trigger) {
+                    if(GET_BKPOINTFLAG(1) & BKPT_COND) {
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
+                        BreakPtFlags |= BKPT_ALLPAUSED;
+
+                        // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
+
+                        rplPushDataNoGrow(BreakPt2Arg);
+                        IPtr = (WORDPTR) bkpoint_seco;
+                        CurOpcode = 0;
+                        Exceptions = 0;     //    CLEAR ERRORS AND GO...
+
+                    }
+                    else {
+
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        Exceptions = EX_HALT;
+
+                    }
+
+                }
+            }
+
+            if(!trigger && (GET_BKPOINTFLAG(2) & BKPT_ENABLED)) {
+                if(GET_BKPOINTFLAG(2) & BKPT_LOCATION) {
+                    WORDPTR nextopcode =
+                            IPtr + 1 +
+                            ((ISPROLOG(CurOpcode)) ?
+                            OBJSIZE(CurOpcode) : 0);
+                    if((nextopcode >= BreakPt3Pointer)
+                            && (nextopcode <
+                                rplSkipOb(BreakPt3Pointer))) {
+                        if(!(Exceptions & EX_HWBKPTSKIP))
+                            trigger = 1;
+                    }
+                }
+                else if(!(Exceptions & EX_HWBKPTSKIP))
+                    trigger = 1;
+
+                if(trigger) {
+
+                    // SINGLE STEP BREAKPOINT DISABLES ITSELF AFTER IT'S TRIGGERED
+                    SET_BKPOINTFLAG(2,
+                            GET_BKPOINTFLAG(2) & (~BKPT_ENABLED));
+
+                    if(GET_BKPOINTFLAG(2) & BKPT_COND) {
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
+                        BreakPtFlags |= BKPT_ALLPAUSED;
+
+                        // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
+
+                        rplPushDataNoGrow(BreakPt3Arg);
+                        IPtr = (WORDPTR) bkpoint_seco;
+                        CurOpcode = 0;
+                        Exceptions = 0;     //    CLEAR ERRORS AND GO...
+
+                    }
+                    else {
+
+                        // HALT CURRENT PROGRAM
+                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+                        HaltedIPtr =
+                                IPtr + 1 +
+                                ((ISPROLOG(CurOpcode)) ?
+                                OBJSIZE(CurOpcode) : 0);
+                        HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
+                        HaltednLAMBase = nLAMBase;
+                        HaltedLAMTop = LAMTop;
+
+                        Exceptions = EX_HALT;
+
+                    }
+
+                }
+            }
+
+        }
+        else {
+            // CHECK IF WE ARE DONE WITH THE BREAKPOINT CONDITION ROUTINE
+            // WARNING!!!: DO NOT MODIFY bkpoint_seco WITHOUT FIXING THIS!!
+            if(IPtr == bkpoint_seco + 11) {
+                // WE REACHED THE END OF CODE STATEMENT, THEREFORE THE BREAKPOINT WAS TRIGGERED
+                // UN-PAUSE ALL HARDWARE BREAKPOINTS
+                BreakPtFlags &= ~BKPT_ALLPAUSED;
+
+                // JUST STAY HALTED AND ISSUE A BREAKPOINT
+                Exceptions = EX_HALT;
+            }
+
+        }
+        Exceptions &= ~(EX_HWBKPOINT | EX_HWBKPTSKIP);
+        if(!Exceptions)
+            return RUN_NEXTOPCODE;
+    }
+
+    // HARD EXCEPTIONS FIRST, DO NOT ALLOW ERROR HANDLERS TO CATCH THESE ONES
+    if(Exceptions & EX_EXITRPL) {
+        Exceptions = 0;
+        rplClearRStk();     // CLEAR THE RETURN STACK
+        rplClearLAMs();     // CLEAR ALL LOCAL VARIABLES
+        ErrorHandler = 0;
+        return CLEAN_RUN;   // DON'T ALLOW HANDLER TO TRAP THIS EXCEPTION
+    }
+
+    if(Exceptions & EX_HWHALT) {
+        // HARDWARE-CAUSED HALT
+        // EMULATE THE HALT INSTRUCTION HERE
+        if(!HaltedIPtr)     // CAN'T HALT WITHIN AN ALREADY HALTED PROGRAM!
+        {
+
+            // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
+            HaltedIPtr =
+                    IPtr + 1 +
+                    ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
+                    0);
+
+            HaltedRSTop = RSTop;    // SAVE RETURN STACK POINTER
+            HaltednLAMBase = nLAMBase;
+            HaltedLAMTop = LAMTop;
+            Exceptions |= EX_HALT;  // CONVERT TO A NORMAL HALT
+        }
+    }
+    if(Exceptions & EX_HALT) {
+        rplSkipNext();      // PREPARE TO RESUME ON NEXT CALL
+        return CODE_HALTED;
+    }
+    if(Exceptions & EX_POWEROFF) {
+        rplSkipNext();      // PREPARE AUTORESUME
+        return CODE_HALTED;
+    }
+
+    if(ErrorHandler) {
+        // ERROR WAS TRAPPED BY A HANDLER
+        rplCatchException();
+        return RUN_TRAPPED;
+    }
+    else {
+        // THERE IS NO ERROR HANDLER --> UNTRAPPED ERROR
+        // SAVE THE EXCEPTIONS FOR ERRN AND ERRM
+        TrappedExceptions = Exceptions;     // THE ERROR HANDLER CAN KNOW THE EXCEPTIONS BY LOOKING AT THIS VARIABLE
+        // ExceptionPointer STILL POINTS TO THE WORD THAT CAUSED THE EXCEPTION
+        TrappedErrorCode = ErrorCode;
+
+        return NEEDS_CLEANUP;       // END EXECUTION IMMEDIATELY IF AN UNHANDLED EXCEPTION IS THROWN
+    }
 }
 
 // RETURNS 0 = FINISHED OK
@@ -322,271 +639,17 @@ BINT rplRun(void)
                 // INVALID OPCODE = END OF EXECUTION (CANNOT BE TRAPPED BY HANDLER)
                 return NEEDS_CLEANUP;
             }
-            Exceptions |= HWExceptions; // COPY HARDWARE EXCEPTIONS INTO EXCEPTIONS AT THIS POINT TO AVOID
-            // STOPPING IN THE MIDDLE OF A COMMAND
-            if(Exceptions) {
-
-                if(HWExceptions)
-                    HWExceptions &= EX_HWBKPOINT;       // CLEAR ANY EXCEPTIONS EXCEPT CHECK FOR BREAKPOINTS
-
-                if(Exceptions & EX_HWBKPOINT) {
-                    if(!HaltedIPtr && !(Exceptions & ~(EX_HWBKPOINT | EX_HWBKPTSKIP)))  // MAKE SURE WE DON'T HALT ALREADY HALTED CODE OR INTERFERE WITH OTHER EXCEPTIONS
-                    {
-                        // CHECK FOR BREAKPOINT TRIGGERS!
-                        int trigger = 0;
-                        if(GET_BKPOINTFLAG(0) & BKPT_ENABLED) {
-                            if(GET_BKPOINTFLAG(0) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt1Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt1Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-                                if(GET_BKPOINTFLAG(0) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt1Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                        // TODO: ADD SAME CODE FOR BREKPOINTS 1 AND 2 HERE
-
-                        if(!trigger && (GET_BKPOINTFLAG(1) & BKPT_ENABLED)) {
-                            if(GET_BKPOINTFLAG(1) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt2Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt2Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-                                if(GET_BKPOINTFLAG(1) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt2Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                        if(!trigger && (GET_BKPOINTFLAG(2) & BKPT_ENABLED)) {
-                            if(GET_BKPOINTFLAG(2) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt3Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt3Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-
-                                // SINGLE STEP BREAKPOINT DISABLES ITSELF AFTER IT'S TRIGGERED
-                                SET_BKPOINTFLAG(2,
-                                        GET_BKPOINTFLAG(2) & (~BKPT_ENABLED));
-
-                                if(GET_BKPOINTFLAG(2) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt3Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                    }
-                    else {
-                        // CHECK IF WE ARE DONE WITH THE BREAKPOINT CONDITION ROUTINE
-                        // WARNING!!!: DO NOT MODIFY bkpoint_seco WITHOUT FIXING THIS!!
-                        if(IPtr == bkpoint_seco + 11) {
-                            // WE REACHED THE END OF CODE STATEMENT, THEREFORE THE BREAKPOINT WAS TRIGGERED
-                            // UN-PAUSE ALL HARDWARE BREAKPOINTS
-                            BreakPtFlags &= ~BKPT_ALLPAUSED;
-
-                            // JUST STAY HALTED AND ISSUE A BREAKPOINT
-                            Exceptions = EX_HALT;
-                        }
-
-                    }
-                    Exceptions &= ~(EX_HWBKPOINT | EX_HWBKPTSKIP);
-                    if(!Exceptions) {
-                        IPtr += 1 +
-                                ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
-                                0);
-                        continue;
-                    }
-                }
-
-                // HARD EXCEPTIONS FIRST, DO NOT ALLOW ERROR HANDLERS TO CATCH THESE ONES
-                if(Exceptions & EX_EXITRPL) {
-                    Exceptions = 0;
-                    rplClearRStk();     // CLEAR THE RETURN STACK
-                    rplClearLAMs();     // CLEAR ALL LOCAL VARIABLES
-                    ErrorHandler = 0;
-                    return CLEAN_RUN;   // DON'T ALLOW HANDLER TO TRAP THIS EXCEPTION
-                }
-
-                if(Exceptions & EX_HWHALT) {
-                    // HARDWARE-CAUSED HALT
-                    // EMULATE THE HALT INSTRUCTION HERE
-                    if(!HaltedIPtr)     // CAN'T HALT WITHIN AN ALREADY HALTED PROGRAM!
-                    {
-
-                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                        HaltedIPtr =
-                                IPtr + 1 +
-                                ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
-                                0);
-
-                        HaltedRSTop = RSTop;    // SAVE RETURN STACK POINTER
-                        HaltednLAMBase = nLAMBase;
-                        HaltedLAMTop = LAMTop;
-                        Exceptions |= EX_HALT;  // CONVERT TO A NORMAL HALT
-                    }
-                }
-                if(Exceptions & EX_HALT) {
-                    rplSkipNext();      // PREPARE TO RESUME ON NEXT CALL
-                    return CODE_HALTED;
-                }
-                if(Exceptions & EX_POWEROFF) {
-                    rplSkipNext();      // PREPARE AUTORESUME
-                    return CODE_HALTED;
-                }
-
-                if(ErrorHandler) {
-                    // ERROR WAS TRAPPED BY A HANDLER
-                    rplCatchException();
-                }
-                else {
-                    // THERE IS NO ERROR HANDLER --> UNTRAPPED ERROR
-                    // SAVE THE EXCEPTIONS FOR ERRN AND ERRM
-                    TrappedExceptions = Exceptions;     // THE ERROR HANDLER CAN KNOW THE EXCEPTIONS BY LOOKING AT THIS VARIABLE
-                    // ExceptionPointer STILL POINTS TO THE WORD THAT CAUSED THE EXCEPTION
-                    TrappedErrorCode = ErrorCode;
-
-                    return NEEDS_CLEANUP;       // END EXECUTION IMMEDIATELY IF AN UNHANDLED EXCEPTION IS THROWN
+            // HARDWARE EXCEPTIONS ARE ONLY CHECKED BETWEEN OPCODES, NEVER IN THE MIDDLE OF A COMMAND
+            if(Exceptions | HWExceptions) {
+                BINT status = rplRunException();
+                if(status == RUN_NEXTOPCODE) {
+                    IPtr += 1 +
+                            ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
+                            0);
+                    continue;
                 }
+                if(status != RUN_TRAPPED)
+                    return status;
             }
 
             // SKIP TO THE NEXT INSTRUCTION / OBJECT BASED ON CurOpcode
@@ -619,272 +682,17 @@ BINT rplRun(void)
                 // INVALID OPCODE = END OF EXECUTION (CANNOT BE TRAPPED BY HANDLER)
                 return NEEDS_CLEANUP;
             }
-            Exceptions |= HWExceptions; // COPY HARDWARE EXCEPTIONS INTO EXCEPTIONS AT THIS POINT TO AVOID
-            // STOPPING IN THE MIDDLE OF A COMMAND
-            if(Exceptions) {
-
-
-                if(HWExceptions)
-                    HWExceptions &= EX_HWBKPOINT;       // CLEAR ANY EXCEPTIONS EXCEPT CHECK FOR BREAKPOINTS
-
-                if(Exceptions & EX_HWBKPOINT) {
-                    if(!HaltedIPtr && !(Exceptions & ~(EX_HWBKPOINT | EX_HWBKPTSKIP)))  // MAKE SURE WE DON'T HALT ALREADY HALTED CODE OR INTERFERE WITH OTHER EXCEPTIONS
-                    {
-                        // CHECK FOR BREAKPOINT TRIGGERS!
-                        int trigger = 0;
-                        if(GET_BKPOINTFLAG(0) & BKPT_ENABLED) {
-                            if(GET_BKPOINTFLAG(0) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt1Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt1Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-                                if(GET_BKPOINTFLAG(0) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt1Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                        // TODO: ADD SAME CODE FOR BREKPOINTS 1 AND 2 HERE
-
-                        if(!trigger && (GET_BKPOINTFLAG(1) & BKPT_ENABLED)) {
-                            if(GET_BKPOINTFLAG(1) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt2Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt2Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-                                if(GET_BKPOINTFLAG(1) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt2Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                        if(!trigger && (GET_BKPOINTFLAG(2) & BKPT_ENABLED)) {
-                            if(GET_BKPOINTFLAG(2) & BKPT_LOCATION) {
-                                WORDPTR nextopcode =
-                                        IPtr + 1 +
-                                        ((ISPROLOG(CurOpcode)) ?
-                                        OBJSIZE(CurOpcode) : 0);
-                                if((nextopcode >= BreakPt3Pointer)
-                                        && (nextopcode <
-                                            rplSkipOb(BreakPt3Pointer))) {
-                                    if(!(Exceptions & EX_HWBKPTSKIP))
-                                        trigger = 1;
-                                }
-                            }
-                            else if(!(Exceptions & EX_HWBKPTSKIP))
-                                trigger = 1;
-
-                            if(trigger) {
-
-                                // SINGLE STEP BREAKPOINT DISABLES ITSELF AFTER IT'S TRIGGERED
-                                SET_BKPOINTFLAG(2,
-                                        GET_BKPOINTFLAG(2) & (~BKPT_ENABLED));
-
-                                if(GET_BKPOINTFLAG(2) & BKPT_COND) {
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    // PAUSE ALL HARDWARE BREAKPOINTS UNTIL CONDITION IS EXECUTED
-                                    BreakPtFlags |= BKPT_ALLPAUSED;
-
-                                    // PREPARE TO EXECUTE THE CONDITION - MUST BE A SECONDARY
-
-                                    rplPushDataNoGrow(BreakPt3Arg);
-                                    IPtr = (WORDPTR) bkpoint_seco;
-                                    CurOpcode = 0;
-                                    Exceptions = 0;     //    CLEAR ERRORS AND GO...
-
-                                }
-                                else {
-
-                                    // HALT CURRENT PROGRAM
-                                    // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                                    HaltedIPtr =
-                                            IPtr + 1 +
-                                            ((ISPROLOG(CurOpcode)) ?
-                                            OBJSIZE(CurOpcode) : 0);
-                                    HaltedRSTop = RSTop;        // SAVE RETURN STACK POINTER
-                                    HaltednLAMBase = nLAMBase;
-                                    HaltedLAMTop = LAMTop;
-
-                                    Exceptions = EX_HALT;
-
-                                }
-
-                            }
-                        }
-
-                    }
-                    else {
-                        // CHECK IF WE ARE DONE WITH THE BREAKPOINT CONDITION ROUTINE
-                        // WARNING!!!: DO NOT MODIFY bkpoint_seco WITHOUT FIXING THIS!!
-                        if(IPtr == bkpoint_seco + 11) {
-                            // WE REACHED THE END OF CODE STATEMENT, THEREFORE THE BREAKPOINT WAS TRIGGERED
-                            // UN-PAUSE ALL HARDWARE BREAKPOINTS
-                            BreakPtFlags &= ~BKPT_ALLPAUSED;
-
-                            // JUST STAY HALTED AND ISSUE A BREAKPOINT
-                            Exceptions = EX_HALT;
-                        }
-
-                    }
-                    Exceptions &= ~(EX_HWBKPOINT | EX_HWBKPTSKIP);
-                    if(!Exceptions) {
-                        IPtr += 1 +
-                                ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
-                                0);
-                        continue;
-                    }
-                }
-
-                // HARD EXCEPTIONS FIRST, DO NOT ALLOW ERROR HANDLERS TO CATCH THESE ONES
-                if(Exceptions & EX_EXITRPL) {
-                    Exceptions = 0;
-                    rplClearRStk();     // CLEAR THE RETURN STACK
-                    rplClearLAMs();     // CLEAR ALL LOCAL VARIABLES
-                    ErrorHandler = 0;
-                    return CLEAN_RUN;   // DON'T ALLOW HANDLER TO TRAP THIS EXCEPTION
-                }
-
-                if(Exceptions & EX_HWHALT) {
-                    // HARDWARE-CAUSED HALT
-                    // EMULATE THE HALT INSTRUCTION HERE
-                    if(!HaltedIPtr)     // CAN'T HALT WITHIN AN ALREADY HALTED PROGRAM!
-                    {
-
-                        // SAVE THE ADDRESS OF THE NEXT INSTRUCTION
-                        HaltedIPtr =
-                                IPtr + 1 +
-                                ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
-                                0);
-
-                        HaltedRSTop = RSTop;    // SAVE RETURN STACK POINTER
-                        HaltednLAMBase = nLAMBase;
-                        HaltedLAMTop = LAMTop;
-                        Exceptions |= EX_HALT;  // CONVERT TO A NORMAL HALT
-                    }
-                }
-                if(Exceptions & EX_HALT) {
-                    rplSkipNext();      // PREPARE TO RESUME ON NEXT CALL
-                    return CODE_HALTED;
-                }
-                if(Exceptions & EX_POWEROFF) {
-                    rplSkipNext();      // PREPARE AUTORESUME
-                    return CODE_HALTED;
-                }
-
-                if(ErrorHandler) {
-                    // ERROR WAS TRAPPED BY A HANDLER
-                    rplCatchException();
-                }
-                else {
-                    // THERE IS NO ERROR HANDLER --> UNTRAPPED ERROR
-                    // SAVE THE EXCEPTIONS FOR ERRN AND ERRM
-                    TrappedExceptions = Exceptions;     // THE ERROR HANDLER CAN KNOW THE EXCEPTIONS BY LOOKING AT THIS VARIABLE
-                    // ExceptionPointer STILL POINTS TO THE WORD THAT CAUSED THE EXCEPTION
-                    TrappedErrorCode = ErrorCode;
-
-                    return NEEDS_CLEANUP;       // END EXECUTION IMMEDIATELY IF AN UNHANDLED EXCEPTION IS THROWN
+            // HARDWARE EXCEPTIONS ARE ONLY CHECKED BETWEEN OPCODES, NEVER IN THE MIDDLE OF A COMMAND
+            if(Exceptions | HWExceptions) {
+                BINT status = rplRunException();
+                if(status == RUN_NEXTOPCODE) {
+                    IPtr += 1 +
+                            ((ISPROLOG(CurOpcode)) ? OBJSIZE(CurOpcode) :
+                            0);
+                    continue;
                 }
+                if(status != RUN_TRAPPED)
+                    return status;
             }
 
             // PROVIDE RPN-MODE STACK BEHAVIOR
@@ -1169,6 +977,7 @@ void rplInitMemoryAllocator()
     }
     // INITIALIZE TEMP STORAGE FOR INTEGER TO REAL CONVERSION
     BINT2RealIdx = 0;
+    BigInt2RealIdx = 0;
 
     // INITIALIZE MEMORY ALLOCATOR FOR OTHER USES
     init_simpalloc();
@@ -1222,8 +1031,14 @@ void rplInit(void)
     LAMTop = LAMs;
     nLAMBase = LAMTop;
     TempBlocksEnd = TempBlocks;
+    rplGCResetGenerations();
     CurrentDir = Directories;
     DirsTop = Directories;
+    rplClearDirIndex();
+    rplClearListIndex();
+    rplClearSymbCache();
+    uiClearRenderCache();
+    rplUnitBuildIndex();
     ErrorHandler = 0;   // INITIALLY THERE'S NO ERROR HANDLER, AN EXCEPTION WILL EXIT THE RPL LOOP
 
     // INITIALIZE THE HOME DIRECTORY
@@ -1283,9 +1098,17 @@ void rplWarmInit(void)
     rplRandomSeed(rplRandomNext() ^ 0xbad1dea);
 
     // FINALLY, CHECK EXISTING MEMORY FOR DAMAGE AND REPAIR AUTOMATICALLY
+    rplClearDirIndex();
+    rplClearListIndex();
+    rplClearSymbCache();
+    uiClearRenderCache();
+    rplUnitBuildIndex();
     rplVerifyTempOb(1);
     rplVerifyDirectories(1);
 
+    // TEMPOB MAY HAVE BEEN RESTORED OR REPAIRED, START WITH A SINGLE GENERATION
+    rplGCResetGenerations();
+
     // VERIFY IF SETTINGS AND ROOT DIRECTORY ARE PROPERLY SET
 
     WORDPTR *settings = rplFindGlobal((WORDPTR) dotsettings_ident, 0);
@@ -1377,9 +1200,17 @@ void rplHotInit()
     initContext(Context.precdigits);
 
     // FINALLY, CHECK EXISTING MEMORY FOR DAMAGE AND REPAIR AUTOMATICALLY
+    rplClearDirIndex();
+    rplClearListIndex();
+    rplClearSymbCache();
+    uiClearRenderCache();
+    rplUnitBuildIndex();
     rplVerifyTempOb(1);
     rplVerifyDirectories(1);
 
+    // TEMPOB MAY HAVE BEEN RESTORED OR REPAIRED, START WITH A SINGLE GENERATION
+    rplGCResetGenerations();
+
     // VERIFY IF SETTINGS AND ROOT DIRECTORY ARE PROPERLY SET
 
     WORDPTR *settings =
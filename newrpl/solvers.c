@@ -557,6 +557,53 @@ WORDPTR rplPolyDeflateEx(WORDPTR * first, BINT degree, WORDPTR * value)
 
 }
 
+// RUN THE COMPILED VERSION OF A USER FUNCTION 'f(X,Y,Z)=EXPRESSION', COMPILING IT ON FIRST USE
+// RETURN 0 IF THE FUNCTION OR ITS ARGUMENTS NEED THE GENERAL EVALUATOR
+// RETURN 1 IF THE FUNCTION WAS EVALUATED, OR AN ERROR WAS RAISED
+
+static BINT rplRunCompiledUserFunc(WORDPTR userfunc)
+{
+    WORDPTR *dstksave = DSTop;
+    WORDPTR code, ptr = userfunc + 4;
+    WORDPTR endofcall = rplSkipOb(userfunc + 2);
+    WORD hash;
+    BINT nargs = 0, k;
+
+    while(rplSkipOb(ptr) < endofcall) {
+        ++nargs;
+        ptr = rplSkipOb(ptr);
+    }
+    if(rplDepthData() < nargs)
+        return 0;
+    // ANGLES, UNITS AND SYMBOLICS AS ARGUMENTS NEED THE GENERAL EVALUATOR
+    for(k = 1; k <= nargs; ++k) {
+        ptr = rplPeekData(k);
+        if(!ISBINT(*ptr) && !ISREAL(*ptr) && !ISCOMPLEX(*ptr))
+            return 0;
+    }
+
+    code = rplSymbCacheFind(userfunc, SYMBCACHE_COMPILED, &hash);
+    if(!code) {
+        rplPushData(userfunc);
+        if(Exceptions)
+            return 1;
+        code = rplAsmCompileUserFunc(userfunc);
+        userfunc = rplPopData();
+        if(Exceptions)
+            return 1;
+        if(!code)
+            code = (WORDPTR) zero_bint;     // REMEMBER IT CAN'T BE COMPILED
+        rplSymbCacheStore(userfunc, SYMBCACHE_COMPILED, hash, code);
+    }
+    if(code == (WORDPTR) zero_bint)
+        return 0;
+
+    rplAsmRunCode(code);
+    if(Exceptions)
+        DSTop = dstksave;
+    return 1;
+}
+
 // EVALUATES A USER-DEFINED FUNCTION
 // IT CAN BE A PROGRAM OR AN ALGEBRAIC IN THE FORM 'f(X,Y,Z)=EXPRESSION'
 // IT WILL TAKE n ARGUMENTS FROM THE STACK, PUT IT IN LOCAL VARIABLES (X,Y,Z), THEN EVALUATE THE EXPRESSION WITH THE GIVEN OPCODE (->NUM OR EVAL)
@@ -571,6 +618,10 @@ void rplEvalUserFunc(WORDPTR arg_userfunc, WORD Opcode)
             && (arg_userfunc[1] == CMD_EQUATIONOPERATOR)
             && (ISSYMBOLIC(arg_userfunc[2]))
             && (arg_userfunc[3] == CMD_OVR_FUNCEVAL)) {
+        // PURELY NUMERIC FUNCTIONS RUN COMPILED, WITHOUT CREATING ANY LAMS
+        if((Opcode == CMD_OVR_NUM) && rplRunCompiledUserFunc(arg_userfunc))
+            return;
+
         // CREATE LAMS FOR ALL FUNCTION ARGUMENTS
         ScratchPointer1 = arg_userfunc + 4;     // FIRST ARGUMENT
         ScratchPointer2 = rplSkipOb(arg_userfunc + 2);  // END OF SYMBOLIC FUNCTION CALL
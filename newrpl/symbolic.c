@@ -1542,8 +1542,117 @@ WORDPTR *rplSymbExplodeCanonicalForm(WORDPTR object, BINT for_display)
 
 }
 
+// CANONICAL FORM CACHE
+// REMEMBERS THE CANONICAL AND SIMPLIFIED FORMS OF RECENTLY PROCESSED SYMBOLICS
+// ENTRIES ARE FOUND BY CHECKSUM AND VERIFIED WITH rplCompareObjects()
+// THE CACHE IS NOT A GC ROOT, ENTRIES POINTING TO OBJECTS THAT MAY MOVE OR
+// DIE ARE DROPPED BY THE GARBAGE COLLECTOR, SO IT NEVER HOLDS ANY MEMORY
+
+// DROP ALL CACHED FORMS
+void rplClearSymbCache()
+{
+    BINT k;
+    for(k = 0; k < SYMBCACHESIZE; ++k)
+        SymbCacheKey[k] = 0;
+}
+
+// DROP ONLY THE CACHED FORMS OF THE GIVEN KIND
+void rplClearSymbCacheKind(BINT kind)
+{
+    BINT k;
+    for(k = 0; k < SYMBCACHESIZE; ++k)
+        if(SymbCacheKind[k] == kind)
+            SymbCacheKey[k] = 0;
+}
+
+// DROP ALL CACHED FORMS THAT REFER TO OBJECTS IN TEMPOB AT OR ABOVE limit
+void rplReleaseSymbCache(WORDPTR limit)
+{
+    BINT k;
+    for(k = 0; k < SYMBCACHESIZE; ++k) {
+        if(((SymbCacheKey[k] >= limit) && (SymbCacheKey[k] < TempObSize))
+                || ((SymbCacheResult[k] >= limit)
+                    && (SymbCacheResult[k] < TempObSize)))
+            SymbCacheKey[k] = 0;
+    }
+}
+
+// CACHED FORMS DEPEND ON THE FLAGS AND PRECISION, FORGET THEM ALL IF EITHER CHANGED
+static void rplSymbCacheCheckState()
+{
+    BINT k, changed = 0;
+    WORD state[4];
+
+    // STATUS FLAGS CHANGE DURING ANY COMPUTATION BUT DON'T AFFECT THE CACHED FORMS
+    rplGetSystemFlagsSettings(state);
+
+    if(SymbCacheState[4] != (WORD) Context.precdigits)
+        changed = 1;
+    for(k = 0; k < 4; ++k)
+        if(SymbCacheState[k] != state[k])
+            changed = 1;
+    if(!changed)
+        return;
+
+    rplClearSymbCache();
+    for(k = 0; k < 4; ++k)
+        SymbCacheState[k] = state[k];
+    SymbCacheState[4] = (WORD) Context.precdigits;
+}
+
+// RETURN THE CACHED FORM OF object, OR 0 IF NOT FOUND
+// ALSO RETURNS THE CHECKSUM TO BE USED LATER TO STORE THE NEW ENTRY
+WORDPTR rplSymbCacheFind(WORDPTR object, BINT kind, WORD * hash)
+{
+    BINT k;
+
+    rplSymbCacheCheckState();
+    *hash = (WORD) rplObjChecksum(object);
+    k = (*hash + kind) & (SYMBCACHESIZE - 1);
+    if(SymbCacheKey[k] && (SymbCacheHash[k] == *hash)
+            && (SymbCacheKind[k] == kind)
+            && rplCompareObjects(SymbCacheKey[k], object))
+        return SymbCacheResult[k];
+    return 0;
+}
+
+void rplSymbCacheStore(WORDPTR object, BINT kind, WORD hash,
+        WORDPTR result)
+{
+    BINT k = (hash + kind) & (SYMBCACHESIZE - 1);
+
+    SymbCacheKey[k] = object;
+    SymbCacheResult[k] = result;
+    SymbCacheHash[k] = hash;
+    SymbCacheKind[k] = kind;
+}
+
 // CONVERT A SYMBOLIC OBJECT TO CANONICAL FORM
 WORDPTR rplSymbCanonicalForm(WORDPTR object, BINT fordisplay)
+{
+    BINT kind = fordisplay ? SYMBCACHE_DISPLAY : SYMBCACHE_CANONICAL;
+    WORD hash;
+    WORDPTR finalsymb;
+
+    if(!ISSYMBOLIC(*object))
+        return rplSymbCanonicalFormNoCache(object, fordisplay);
+
+    finalsymb = rplSymbCacheFind(object, kind, &hash);
+    if(finalsymb)
+        return finalsymb;
+
+    rplPushData(object);        // KEEP THE ORIGINAL, IT'S THE KEY TO THE CACHE
+    if(Exceptions)
+        return 0;
+    finalsymb = rplSymbCanonicalFormNoCache(object, fordisplay);
+    object = rplPopData();
+    if(finalsymb)
+        rplSymbCacheStore(object, kind, hash, finalsymb);
+    return finalsymb;
+}
+
+// SAME AS rplSymbCanonicalForm() WITHOUT USING THE CACHE
+WORDPTR rplSymbCanonicalFormNoCache(WORDPTR object, BINT fordisplay)
 {
     WORDPTR *result = rplSymbExplodeCanonicalForm(object, fordisplay);
 
@@ -2783,19 +2892,80 @@ WORDPTR rplSymbNumericReduce(WORDPTR object)
 // ALL NUMERICAL FACTORS IN THE DENOMINATOR ARE MULTIPLIED TOGETHER
 // SYMBOLIC FRACTIONS ARE REDUCED
 
+// FUNCTIONS THAT ALWAYS RETURN THE SAME RESULT FOR THE SAME ARGUMENTS
+// ANY OTHER COMMAND MAY DEPEND ON THE CLOCK, VARIABLES OR OTHER STATE (RAND, TIME, MODRCL...)
+static const WORD symbcache_purecmds[] = {
+    CMD_IP, CMD_FP, CMD_LN, CMD_EXP, CMD_SQRT, CMD_LOG, CMD_ALOG, CMD_EXPM,
+    CMD_LNP1, CMD_SIN, CMD_COS, CMD_TAN, CMD_ASIN, CMD_ACOS, CMD_ATAN,
+    CMD_ATAN2, CMD_SINH, CMD_COSH, CMD_TANH, CMD_ASINH, CMD_ACOSH,
+    CMD_ATANH, CMD_ARG, CMD_RE, CMD_IM, CMD_FLOOR, CMD_CEIL, CMD_SQ,
+    CMD_MIN, CMD_MAX, CMD_MOD, CMD_SIGN
+};
+
+// THE NUMERIC REDUCTION CALLS USER FUNCTIONS AND UNIT CONVERSIONS, WHICH
+// DEPEND ON THE CONTENTS OF VARIABLES. DON'T CACHE SYMBOLICS THAT USE THEM
+// OR THAT USE ANY COMMAND OTHER THAN OPERATORS, CONSTANTS AND PURE FUNCTIONS
+BINT rplSymbIsCacheable(WORDPTR ptr)
+{
+    WORDPTR endofobj = rplSkipOb(ptr);
+    BINT k;
+
+    while(ptr < endofobj) {
+        if(ISSYMBOLIC(*ptr))
+            ptr = rplSymbUnwrap(ptr) + 1;
+        if(ISUNIT(*ptr) || (*ptr == CMD_OVR_FUNCEVAL))
+            return 0;
+        if(!ISPROLOG(*ptr) && !ISBINT(*ptr)
+                && (LIBNUM(*ptr) != LIB_OVERLOADABLE)
+                && (LIBNUM(*ptr) != DOCONST)) {
+            for(k = 0; k < (BINT) (sizeof(symbcache_purecmds) / sizeof(WORD));
+                    ++k)
+                if(symbcache_purecmds[k] == *ptr)
+                    break;
+            if(k == (BINT) (sizeof(symbcache_purecmds) / sizeof(WORD)))
+                return 0;
+        }
+        ptr = rplSkipOb(ptr);
+    }
+    return 1;
+}
+
 void rplSymbAutoSimplify()
 {
+    WORD hash;
+    WORDPTR newobj;
+    BINT cached = 0;
+
+    if(ISSYMBOLIC(*rplPeekData(1)) && rplSymbIsCacheable(rplPeekData(1))) {
+        newobj = rplSymbCacheFind(rplPeekData(1), SYMBCACHE_SIMPLIFIED, &hash);
+        if(newobj) {
+            rplOverwriteData(1, newobj);
+            return;
+        }
+        // KEEP THE ORIGINAL, IT'S THE KEY TO THE CACHE
+        rplPushData(rplPeekData(1));
+        if(Exceptions)
+            return;
+        cached = 1;
+    }
 
-    WORDPTR newobj = rplSymbCanonicalForm(rplPeekData(1), 0);
-    if(newobj)
+    newobj = rplSymbCanonicalForm(rplPeekData(1), 0);
+    if(newobj) {
         rplOverwriteData(1, newobj);
-    else
-        return;
 
-    newobj = rplSymbNumericReduce(rplPeekData(1));
+        newobj = rplSymbNumericReduce(rplPeekData(1));
 
-    if(newobj)
-        rplOverwriteData(1, newobj);
+        if(newobj)
+            rplOverwriteData(1, newobj);
+    }
+
+    if(cached) {
+        if(newobj && !Exceptions)
+            rplSymbCacheStore(rplPeekData(2), SYMBCACHE_SIMPLIFIED, hash,
+                    rplPeekData(1));
+        rplOverwriteData(2, rplPeekData(1));
+        rplDropData(1);
+    }
     return;
 }
 
@@ -3365,20 +3535,11 @@ void rplSymbReplaceMatchHere(WORDPTR * rule, BINT startleftarg)
 
 // NEW VERSION 3 IMPLEMENTATION
 
-BINT rplSymbRuleMatch()
-{
-    // MAKE SURE BOTH EXPRESSION AND RULE ARE IN CANONIC FORM
-    WORDPTR newexp = rplSymbCanonicalForm(rplPeekData(2), 0);
-    if(!newexp || Exceptions) {
-        return 0;
-    }
-    rplPushDataNoGrow(newexp);
-    newexp = rplSymbCanonicalForm(rplPeekData(2), 0);
-    if(!newexp || Exceptions) {
-        return 0;
-    }
-    rplPushDataNoGrow(newexp);
+// THE MATCHING ENGINE, EXPECTS THE ORIGINAL EXPRESSION AND RULE IN LEVELS 4 AND 3
+// AND THEIR CANONICAL FORMS IN LEVELS 2 AND 1
 
+static BINT ruleMatchInStack()
+{
     // ******************************************************
     // DEBUG ONLY AREA
     // ******************************************************
@@ -6445,6 +6606,92 @@ BINT rplSymbRuleMatch()
     return found;
 }
 
+BINT rplSymbRuleMatch()
+{
+    // MAKE SURE BOTH EXPRESSION AND RULE ARE IN CANONIC FORM
+    WORDPTR newexp = rplSymbCanonicalForm(rplPeekData(2), 0);
+    if(!newexp || Exceptions) {
+        return 0;
+    }
+    rplPushDataNoGrow(newexp);
+    newexp = rplSymbCanonicalForm(rplPeekData(2), 0);
+    if(!newexp || Exceptions) {
+        return 0;
+    }
+    rplPushDataNoGrow(newexp);
+
+    return ruleMatchInStack();
+}
+
+// SAME AS rplSymbRuleMatch() BUT THE CALLER GUARANTEES THAT BOTH THE
+// EXPRESSION AND THE RULE ARE ALREADY IN CANONICAL FORM
+
+BINT rplSymbRuleMatchCanonical()
+{
+    rplPushDataNoGrow(rplPeekData(2));
+    rplPushDataNoGrow(rplPeekData(2));
+
+    return ruleMatchInStack();
+}
+
+// RETURN FALSE IF A RULE CAN'T POSSIBLY MATCH AN EXPRESSION THAT ONLY USES
+// THE OPERATORS IN THE LIST ops (AS OBTAINED FROM rplSymbCollectOperators)
+// EVERY OPERATOR IN THE LEFT SIDE OF THE RULE NEEDS A NODE WITH THE SAME
+// OPERATOR IN THE EXPRESSION, ONLY THE SPECIAL IDENTS MATCH ENTIRE SUBEXPRESSIONS
+
+BINT rplSymbRuleCanMatch(WORDPTR rule, WORD * ops, BINT nops)
+{
+    WORDPTR ptr = rplSymbMainOperatorPTR(rule), endofobj;
+    BINT k;
+
+    if(!ptr || (*ptr != CMD_RULESEPARATOR))
+        return 1;
+    ++ptr;
+    endofobj = rplSkipOb(ptr);
+
+    while(ptr < endofobj) {
+        if(ISSYMBOLIC(*ptr)) {
+            ptr = rplSymbUnwrap(ptr) + 1;
+            if(!ISPROLOG(*ptr) && !ISBINT(*ptr) && !ISCONSTANT(*ptr)) {
+                for(k = 0; k < nops; ++k)
+                    if(ops[k] == *ptr)
+                        break;
+                if(k == nops)
+                    return 0;
+            }
+        }
+        ptr = rplSkipOb(ptr);
+    }
+    return 1;
+}
+
+// COLLECT ALL DISTINCT OPERATORS USED ANYWHERE IN A SYMBOLIC
+// RETURN THE NUMBER OF OPERATORS STORED IN ops, OR -1 IF THERE'S MORE THAN maxops
+
+BINT rplSymbCollectOperators(WORDPTR symbolic, WORD * ops, BINT maxops)
+{
+    WORDPTR ptr = symbolic, endofobj = rplSkipOb(symbolic);
+    BINT nops = 0, k;
+
+    while(ptr < endofobj) {
+        if(ISSYMBOLIC(*ptr)) {
+            ptr = rplSymbUnwrap(ptr) + 1;
+            if(!ISPROLOG(*ptr) && !ISBINT(*ptr) && !ISCONSTANT(*ptr)) {
+                for(k = 0; k < nops; ++k)
+                    if(ops[k] == *ptr)
+                        break;
+                if(k == nops) {
+                    if(nops == maxops)
+                        return -1;
+                    ops[nops++] = *ptr;
+                }
+            }
+        }
+        ptr = rplSkipOb(ptr);
+    }
+    return nops;
+}
+
 // ATTRIBUTES OF AN IDENTIFIER FOR THE CAS:
 // IF NO ATTRIBUTE IS ADDED TO THE NAME OF THE VARIABLE, A VARIABLE IS CONSIDERED FINITE AND REAL (OR FINITE AND COMPLEX IF COMPLEX MODE IS ENABLED)
 
@@ -70,6 +70,15 @@ LIBHANDLER SysHiLibRegistry[MAXSYSHILIBS];
 LIBHANDLER HiLibRegistry[MAXHILIBS];
 BINT HiLibNumbers[MAXHILIBS];
 BINT NumHiLibs;
+HALFWORD HiLibIndex[MAXUSERLIBNUMBER];  // POSITION+1 IN HiLibRegistry OF EACH USER LIBRARY NUMBER, 0 IF NOT INSTALLED
+
+// COMMAND NAME INDEX FOR THE COMPILER
+CMDINDEXENTRY CmdIndex[MAXCMDINDEX];
+HALFWORD CmdIndexBuckets[CMDINDEXBUCKETS];
+BINT CmdIndexUsed;
+WORD CmdIndexedLibs[(MAXLIBNUMBER + 1) / 32];  // BITMAP OF LIBRARIES RESOLVED THROUGH THE INDEX
+HALFWORD CompileProbeLibs[MAXLOWLIBS + MAXSYSHILIBS + MAXHILIBS];       // LIBRARIES THAT NEED PROBING, FROM HIGH TO LOW
+BINT NumCompileProbeLibs;
 
 // OTHER RPL CORE VARIABLES THAT ARE NOT AFFECTED BY GC
 WORD CurOpcode; // CURRENT OPCODE (WORD)
@@ -77,6 +86,36 @@ WORD HWExceptions, Exceptions, TrappedExceptions;       // FLAGS FOR CURRENT EXC
 WORD BreakPtFlags;      // FLAGS FOR HARDWARE BREAK POINTS
 WORD ErrorCode, TrappedErrorCode;
 WORD GCFlags;   // INTERNAL REGISTER TO INDICATE SPECIAL CONDITIONS, LIKE A GARBAGE COLLECTION HAPPENED
+BINT64 GCMaxPause;      // LONGEST GARBAGE COLLECTION IN TIMER TICKS, RESET BY GCPAUSE
+WORDPTR GCRelocStart[GCRELOCSIZE];      // RELOCATION TABLE: OLD START OF EACH MOVED RUN OF BLOCKS
+WORDPTR GCRelocEnd[GCRELOCSIZE];        // OLD END OF EACH MOVED RUN OF BLOCKS
+BINT GCRelocOffset[GCRELOCSIZE];        // DISPLACEMENT OF EACH MOVED RUN OF BLOCKS
+BINT GCNumRelocs;       // NUMBER OF PENDING ENTRIES IN THE RELOCATION TABLE
+BINT GCAgeBlocks[GCPROMOTEAGE];  // FIRST TEMPBLOCK OF EACH YOUNG GENERATION, OLDEST FIRST
+WORDPTR DirIndexHandle[DIRINDEXDIRS];   // HANDLE OF EACH INDEXED DIRECTORY, NULL IF FREE
+BINT DirIndexCount[DIRINDEXDIRS];       // NUMBER OF VARIABLES WHEN THE INDEX WAS LAST UPDATED
+BINT DirIndexStart[DIRINDEXDIRS];       // FIRST SLOT OF EACH INDEX WITHIN DirIndexTable
+BINT DirIndexMask[DIRINDEXDIRS];        // NUMBER OF SLOTS - 1 (POWER OF 2)
+BINT DirIndexUsed;      // SLOTS ALLOCATED IN DirIndexTable
+HALFWORD DirIndexTable[DIRINDEXSIZE];   // OPEN ADDRESSING SLOTS, POSITION OF THE VARIABLE FROM THE END OF DIR
+WORDPTR IdentCacheSite[IDENTCACHESIZE]; // ADDRESS OF THE IDENT WITHIN THE PROGRAM BEING EXECUTED
+WORDPTR *IdentCacheVar[IDENTCACHESIZE]; // LAM OR GLOBAL KEY/VALUE PAIR THE IDENT RESOLVED TO
+WORDPTR *IdentCacheLAMTop[IDENTCACHESIZE];      // LAMTop AT THE TIME OF RESOLUTION
+WORDPTR *IdentCacheDir[IDENTCACHESIZE]; // CurrentDir AT THE TIME OF RESOLUTION
+WORD IdentCacheGen[IDENTCACHESIZE];     // IdentGeneration AT THE TIME OF RESOLUTION
+WORD IdentGeneration;   // INCREASED WHENEVER LAMS OR DIRECTORY ENTRIES ARE ADDED, REMOVED OR MOVED
+WORDPTR ListIndexList[LISTINDEXLISTS];  // ADDRESS OF EACH INDEXED LIST, NULL IF FREE
+WORD ListIndexProlog[LISTINDEXLISTS];   // PROLOG OF THE LIST WHEN IT WAS INDEXED
+BINT ListIndexCount[LISTINDEXLISTS];    // NUMBER OF ELEMENTS IN THE LIST
+BINT ListIndexShift[LISTINDEXLISTS];    // ONE OFFSET IS STORED EVERY 2^ListIndexShift ELEMENTS
+BINT ListIndexNext;     // NEXT INDEX TO BE REPLACED WHEN ALL ARE IN USE
+WORD ListIndexOffset[LISTINDEXLISTS * LISTINDEXSIZE];   // OFFSET OF THE ELEMENTS FROM THE START OF EACH LIST
+WORDPTR SymbCacheKey[SYMBCACHESIZE];    // ORIGINAL SYMBOLIC OF EACH CACHED ENTRY, NULL IF FREE
+WORDPTR SymbCacheResult[SYMBCACHESIZE]; // CANONICAL OR SIMPLIFIED FORM OF THE SYMBOLIC
+WORD SymbCacheHash[SYMBCACHESIZE];      // CHECKSUM OF THE ORIGINAL SYMBOLIC
+BINT SymbCacheKind[SYMBCACHESIZE];      // WHICH FORM WAS CACHED (SYMBCACHE_XXX)
+WORD SymbCacheState[5];  // SYSTEM FLAGS AND PRECISION THE CACHED FORMS WERE COMPUTED WITH
+HALFWORD UnitIndexTable[UNITINDEXSIZE];  // OPEN ADDRESSING SLOTS, INDEX OF THE SYSTEM UNIT + 1
 WORDPTR *ValidateTop;   // TEMPORARY DATA AFTER THE RETURN STACK USED DURING COMPILATION
 WORDPTR *ValidateBottom;        // TEMPORARY DATA AFTER THE RETURN STACK USED DURING COMPILATION
 WORDPTR *ErrornLAMBase; // SAVED BASE OF LAM ENVIRONMENT AT ERROR HANDLER
@@ -89,11 +128,15 @@ UBINT ArgNum1, ArgNum2, ArgNum3, RetNum;
 
 // MULTIPRECISION LIBRARY CONTEXT
 // INCLUDES STORAGE FOR REAL REGISTERS
-DECIMAL_CONTEXT Context;
+DECIMAL_CONTEXT DefaultContext;
+DECIMAL_THREADLOCAL DECIMAL_CONTEXT *CurrentContext = &DefaultContext;
 
 // TEMPORARY SCRATCH MEMORY FOR DIGITS
 BINT RDigits[EXTRA_STORAGE];
-// PREALLOCATED STATIC REAL NUMBER REGISTERS FOR TEMPORARY STORAGE
-REAL RReg[REAL_REGISTERS];
 
 BINT BINT2RealIdx;
+
+// TEMPORARY SCRATCH MEMORY FOR DIGITS OF BIG INTEGERS CONVERTED TO REALS
+BINT BigIntDigits[BIGINT_EXTRA_STORAGE];
+
+BINT BigInt2RealIdx;
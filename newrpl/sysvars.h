@@ -36,6 +36,7 @@ extern WORDPTR GC_PTRUpdate[MAX_GC_PTRUPDATE];
 
 #define ArgPtr2             GC_PTRUpdate[6]     // NAME FOR USE BY LIBRARIES
 #define BlankStart          GC_PTRUpdate[6]     // NAME AS USED BY THE COMPILER
+#define LibraryCmdNames     GC_PTRUpdate[6]     // NAME AS USED BY THE LIBRARY INSTALLATION ROUTINES
 #define DecompStringEnd     GC_PTRUpdate[6]     // NAME AS USED BY THE DECOMPILER
 
 #define EndOfObject         GC_PTRUpdate[7]     // NAME AS USED BY THE DECOMPILER
@@ -89,6 +90,36 @@ extern WORD HWExceptions, Exceptions, TrappedExceptions;       // FLAGS FOR CURR
 extern WORD BreakPtFlags;      // FLAGS FOR HARDWARE BREAK POINTS
 extern WORD ErrorCode, TrappedErrorCode;
 extern WORD GCFlags;   // INTERNAL REGISTER TO INDICATE SPECIAL CONDITIONS, LIKE A GARBAGE COLLECTION HAPPENED
+extern BINT64 GCMaxPause;      // LONGEST GARBAGE COLLECTION IN TIMER TICKS, RESET BY GCPAUSE
+extern WORDPTR GCRelocStart[GCRELOCSIZE];      // RELOCATION TABLE: OLD START OF EACH MOVED RUN OF BLOCKS
+extern WORDPTR GCRelocEnd[GCRELOCSIZE];        // OLD END OF EACH MOVED RUN OF BLOCKS
+extern BINT GCRelocOffset[GCRELOCSIZE];        // DISPLACEMENT OF EACH MOVED RUN OF BLOCKS
+extern BINT GCNumRelocs;       // NUMBER OF PENDING ENTRIES IN THE RELOCATION TABLE
+extern BINT GCAgeBlocks[GCPROMOTEAGE];  // FIRST TEMPBLOCK OF EACH YOUNG GENERATION, OLDEST FIRST
+extern WORDPTR DirIndexHandle[DIRINDEXDIRS];   // HANDLE OF EACH INDEXED DIRECTORY, NULL IF FREE
+extern BINT DirIndexCount[DIRINDEXDIRS];       // NUMBER OF VARIABLES WHEN THE INDEX WAS LAST UPDATED
+extern BINT DirIndexStart[DIRINDEXDIRS];       // FIRST SLOT OF EACH INDEX WITHIN DirIndexTable
+extern BINT DirIndexMask[DIRINDEXDIRS];        // NUMBER OF SLOTS - 1 (POWER OF 2)
+extern BINT DirIndexUsed;      // SLOTS ALLOCATED IN DirIndexTable
+extern HALFWORD DirIndexTable[DIRINDEXSIZE];   // OPEN ADDRESSING SLOTS, POSITION OF THE VARIABLE FROM THE END OF DIR
+extern WORDPTR IdentCacheSite[IDENTCACHESIZE]; // ADDRESS OF THE IDENT WITHIN THE PROGRAM BEING EXECUTED
+extern WORDPTR *IdentCacheVar[IDENTCACHESIZE]; // LAM OR GLOBAL KEY/VALUE PAIR THE IDENT RESOLVED TO
+extern WORDPTR *IdentCacheLAMTop[IDENTCACHESIZE];      // LAMTop AT THE TIME OF RESOLUTION
+extern WORDPTR *IdentCacheDir[IDENTCACHESIZE]; // CurrentDir AT THE TIME OF RESOLUTION
+extern WORD IdentCacheGen[IDENTCACHESIZE];     // IdentGeneration AT THE TIME OF RESOLUTION
+extern WORD IdentGeneration;   // INCREASED WHENEVER LAMS OR DIRECTORY ENTRIES ARE ADDED, REMOVED OR MOVED
+extern WORDPTR ListIndexList[LISTINDEXLISTS];  // ADDRESS OF EACH INDEXED LIST, NULL IF FREE
+extern WORD ListIndexProlog[LISTINDEXLISTS];   // PROLOG OF THE LIST WHEN IT WAS INDEXED
+extern BINT ListIndexCount[LISTINDEXLISTS];    // NUMBER OF ELEMENTS IN THE LIST
+extern BINT ListIndexShift[LISTINDEXLISTS];    // ONE OFFSET IS STORED EVERY 2^ListIndexShift ELEMENTS
+extern BINT ListIndexNext;     // NEXT INDEX TO BE REPLACED WHEN ALL ARE IN USE
+extern WORD ListIndexOffset[LISTINDEXLISTS * LISTINDEXSIZE];   // OFFSET OF THE ELEMENTS FROM THE START OF EACH LIST
+extern WORDPTR SymbCacheKey[SYMBCACHESIZE];    // ORIGINAL SYMBOLIC OF EACH CACHED ENTRY, NULL IF FREE
+extern WORDPTR SymbCacheResult[SYMBCACHESIZE]; // CANONICAL OR SIMPLIFIED FORM OF THE SYMBOLIC
+extern WORD SymbCacheHash[SYMBCACHESIZE];      // CHECKSUM OF THE ORIGINAL SYMBOLIC
+extern BINT SymbCacheKind[SYMBCACHESIZE];      // WHICH FORM WAS CACHED (SYMBCACHE_XXX)
+extern WORD SymbCacheState[5];  // SYSTEM FLAGS AND PRECISION THE CACHED FORMS WERE COMPUTED WITH
+extern HALFWORD UnitIndexTable[UNITINDEXSIZE];  // OPEN ADDRESSING SLOTS, INDEX OF THE SYSTEM UNIT + 1
 extern WORDPTR *RSTop; // TOP OF THE RETURN STACK
 extern WORDPTR *HaltedRSTop;   // TOP OF THE RETURN STACK OF HALTED PROGRAM
 extern WORDPTR *DSTop; // TOP OF THE DATA STACK
@@ -118,6 +149,7 @@ extern UBINT ArgNum1, ArgNum2, ArgNum3, RetNum;
 // SOME CONVENIENCE NAMES FOR USE IN LIBRARIES
 #define TokenLen ArgNum1
 #define DecompMode ArgNum1
+#define LibraryNumCmds ArgNum1
 
 #define BlankLen ArgNum2
 #define DecompHints ArgNum2
@@ -136,17 +168,34 @@ extern LIBHANDLER SysHiLibRegistry[MAXSYSHILIBS];
 extern LIBHANDLER HiLibRegistry[MAXHILIBS];
 extern BINT HiLibNumbers[MAXHILIBS];
 extern BINT NumHiLibs;
+extern HALFWORD HiLibIndex[MAXUSERLIBNUMBER];
+
+// COMMAND NAME INDEX FOR THE COMPILER
+extern CMDINDEXENTRY CmdIndex[MAXCMDINDEX];
+extern HALFWORD CmdIndexBuckets[CMDINDEXBUCKETS];
+extern BINT CmdIndexUsed;
+extern WORD CmdIndexedLibs[(MAXLIBNUMBER + 1) / 32];
+extern HALFWORD CompileProbeLibs[MAXLOWLIBS + MAXSYSHILIBS + MAXHILIBS];
+extern BINT NumCompileProbeLibs;
 
 // MATH LIBRARY CONTEXT
-extern DECIMAL_CONTEXT Context;
+extern DECIMAL_CONTEXT DefaultContext;
+extern DECIMAL_THREADLOCAL DECIMAL_CONTEXT *CurrentContext;
+#define Context (*CurrentContext)
 
 // PREALLOCATED STATIC REAL NUMBER REGISTERS FOR TEMPORARY STORAGE
-extern REAL RReg[REAL_REGISTERS];
+// THEY BELONG TO THE CURRENT CONTEXT
+#define RReg (CurrentContext->rreg)
 // TEMPORARY SCRATCH MEMORY FOR DIGITS
 extern BINT RDigits[EXTRA_STORAGE];
 
 extern BINT BINT2RealIdx;
 
+// TEMPORARY SCRATCH MEMORY FOR DIGITS OF BIG INTEGERS CONVERTED TO REALS
+extern BINT BigIntDigits[BIGINT_EXTRA_STORAGE];
+
+extern BINT BigInt2RealIdx;
+
 #ifdef __cplusplus
 }
 #endif
@@ -75,6 +75,9 @@ void rplTruncateLastObject(WORDPTR newend)
         // REMOVE LAST ALLOCATED BLOCK COMPLETELY
         --TempBlocksEnd;
         TempObEnd = *TempBlocksEnd;
+        // THE ADDRESS WILL BE REUSED, FORGET ANY LIST INDEXED THERE
+        rplReleaseListIndex(TempObEnd);
+        rplReleaseSymbCache(TempObEnd);
         return;
     }
 
@@ -89,6 +92,10 @@ void rplTruncateLastObject(WORDPTR newend)
 
     }
     else TempObEnd = newend;
+
+    // ADDRESSES FROM newend WILL BE REUSED, FORGET ANY LIST INDEXED THERE
+    rplReleaseListIndex(newend);
+    rplReleaseSymbCache(newend);
 }
 
 // RESIZE THE LAST OBJECT BY APPENDING WORDS AT THE END OF TEMPOB
@@ -142,8 +149,15 @@ void growTempOb(WORD newtotalsize)
                 newtotalsize);
 
         if(!newtempob) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                // WITHOUT KEEPING THE RENDERED OBJECTS
+                if(gc_done) {
+                    uiClearRenderCache();
+                    rplGCollect();
+                }
+                else
+                    rplGCollectMinor();
                 ++gc_done;
                 newtotalsize = (WORD) (TempObEnd - TempOb) + slack;
             }
@@ -160,6 +174,10 @@ void growTempOb(WORD newtotalsize)
         // TEMPOB HAD TO BE MOVED IN MEMORY
         // FIX ALL DSTK/RSTK/TEMPBLOCKS/DIRECTORIES/LAMS POINTERS
 
+        rplClearSymbCache();
+        rplClearListIndex();
+        rplClearDirIndex();
+
         Patch(DStk, DSTop, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb); // DATA STACK
 
         Patch(RStk, RSTop, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb); // RETURN STACK
@@ -170,6 +188,8 @@ void growTempOb(WORD newtotalsize)
 
         Patch(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE, TempOb, TempObSize + 1, newtempob - (WORDPTR *) TempOb);   // SYSTEM POINTERS, USE TempObSize+1 TO UPDATE POINTERS POINTING TO END OF TEMPOB TOO
 
+        Patch(halCacheBitmap, halCacheBitmap + MAX_RENDERCACHE_ENTRIES, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb);  // RENDERED OBJECTS
+
         Patch(TempBlocks, TempBlocksEnd, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb);   // ALL TEMPBLOCK POINTERS
 
     }
@@ -199,6 +219,10 @@ void shrinkTempOb(WORD newtotalsize)
         // TEMPOB HAD TO BE MOVED IN MEMORY
         // FIX ALL DSTK/RSTK/TEMPBLOCKS/DIRECTORIES/LAMS POINTERS
 
+        rplClearSymbCache();
+        rplClearListIndex();
+        rplClearDirIndex();
+
         Patch(DStk, DSTop, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb); // DATA STACK
 
         Patch(RStk, RSTop, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb); // RETURN STACK
@@ -209,6 +233,8 @@ void shrinkTempOb(WORD newtotalsize)
 
         Patch(GC_PTRUpdate, GC_PTRUpdate + MAX_GC_PTRUPDATE, TempOb, TempObSize + 1, newtempob - (WORDPTR *) TempOb);   // SYSTEM POINTERS, USE TempObSize+1 TO UPDATE POINTERS POINTING TO END OF TEMPOB TOO
 
+        Patch(halCacheBitmap, halCacheBitmap + MAX_RENDERCACHE_ENTRIES, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb);  // RENDERED OBJECTS
+
         Patch(TempBlocks, TempBlocksEnd, TempOb, TempObSize, newtempob - (WORDPTR *) TempOb);   // ALL TEMPBLOCK POINTERS
 
     }
@@ -229,8 +255,12 @@ void growTempBlocks(WORD newtotalsize)
                 halGrowMemory(MEM_AREA_TEMPBLOCKS, TempBlocks, newtotalsize);
 
         if(!newtempblocks) {
-            if(!gc_done) {
-                rplGCollect();
+            if(gc_done < 2) {
+                // TRY A MINOR COLLECTION FIRST, THEN A FULL ONE
+                if(gc_done)
+                    rplGCollect();
+                else
+                    rplGCollectMinor();
                 ++gc_done;
                 newtotalsize = (WORD) ((TempBlocksEnd + slack) - TempBlocks);
             }
@@ -2016,73 +2016,136 @@ BINT rplUnitCompare(WORDPTR ident, WORDPTR baseident)
 
 }
 
-// GET THE DEFINITION OF A UNIT FROM ITS IDENTIFIER
-// FIRST IT STRIPS ANY SI PREFIXES AND SEARCHES FOR
-// BOTH THE ORIGINAL UNIT AND THE STRIPPED ONE
-// RETURNS A POINTER WITHIN THE DIRECTORY ENTRY
-// THE FIRST POINTER POINTS TO THE IDENTIFIER
-// THE SECOND TO ITS VALUE
-// THE SEARCH IS DONE FIRST IN THE USER'S UNIT DIRECTORY
-// THEN IN THE SYSTEM BASE UNITS DEFINED IN ROM
-// IF THE siindex POINTER IS NOT NULL, IT STORES THE
-// INDEX TO THE SI PREFIX THAT WAS FOUND IN THE GIVEN NAME
+// HASH INDEX OF THE SYSTEM UNITS
+// THE TABLE IS IN ROM AND NEVER CHANGES, SO THE INDEX IS BUILT ONCE AT STARTUP
+// SLOTS STORE THE INDEX OF THE UNIT IN system_unit_dir PLUS ONE, 0 MARKS AN EMPTY SLOT
 
-WORDPTR *rplUnitFind(WORDPTR ident, BINT * siindex)
+// FNV-1a HASH OF THE TEXT OF A UNIT NAME, WITHOUT ANY PADDING
+static WORD rplUnitNameHash(BYTEPTR name, BYTEPTR nameend)
 {
-    static const BYTE const unitdir_name[] = "UNITS";
+    WORD hash = 2166136261U;
 
-    WORDPTR unitdir_obj =
-            rplGetSettingsbyName((BYTEPTR) unitdir_name,
-            (BYTEPTR) unitdir_name + 5);
-    WORDPTR baseid;
-    BINT result;
-    WORDPTR *entry;
+    while(name < nameend) {
+        hash ^= *name++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
 
-    if(unitdir_obj) {
-        // FOUND UNITS DIRECTORY IN SETTINGS, SCAN IT TO FIND OUT IDENT
-        entry = rplFindFirstByHandle(unitdir_obj);
-        while(entry) {
-            baseid = entry[0];
-
-            result = rplUnitCompare(ident, baseid);
-            if(result) {
-                // WE FOUND A MATCH!
-                if(result < 0)
-                    result = 0;
-                if(siindex)
-                    *siindex = result;
-                return entry;
-            }
+// RETURN THE END OF THE TEXT OF AN IDENT, EXCLUDING ATTRIBUTES AND PADDING
+static BYTEPTR rplUnitNameEnd(WORDPTR ident)
+{
+    BINT nwords = OBJSIZE(*ident);
+    if(LIBNUM(*ident) & HASATTR_BIT)
+        --nwords;
+    BYTEPTR start = (BYTEPTR) (ident + 1);
+    BYTEPTR end = (BYTEPTR) (ident + 1 + nwords);
+    while((end > start) && (*(end - 1) == 0))
+        --end;
+    return end;
+}
 
-            entry = rplFindNext(entry);
-        }
+// BUILD THE INDEX, CALLED ONCE DURING INITIALIZATION
+void rplUnitBuildIndex()
+{
+    BINT k;
+    WORD slot;
+    WORDPTR baseid;
 
-        // NOT FOUND IN THE USERS DIR, TRY THE SYSTEM LIST
+    for(k = 0; k < UNITINDEXSIZE; ++k)
+        UnitIndexTable[k] = 0;
 
+    for(k = 0; system_unit_dir[2 * k]; ++k) {
+        baseid = system_unit_dir[2 * k];
+        slot = rplUnitNameHash((BYTEPTR) (baseid + 1),
+                rplUnitNameEnd(baseid)) & (UNITINDEXSIZE - 1);
+        while(UnitIndexTable[slot])
+            slot = (slot + 1) & (UNITINDEXSIZE - 1);
+        UnitIndexTable[slot] = k + 1;
     }
+}
 
-    // SEARCH THROUGH THE SYSTEM UNITS
+// FIND THE FIRST SYSTEM UNIT WITH THE GIVEN NAME
+// IF siprefix IS TRUE, ONLY UNITS THAT ACCEPT SI PREFIXES ARE CONSIDERED
+// RETURNS THE INDEX OF THE UNIT IN system_unit_dir, OR -1 IF NOT FOUND
+static BINT rplUnitFindSystem(BYTEPTR name, BYTEPTR nameend, BINT siprefix)
+{
+    WORD slot = rplUnitNameHash(name, nameend) & (UNITINDEXSIZE - 1);
+    BINT found = -1, idx;
+    WORDPTR baseid;
+    BYTEPTR st1, st2;
 
-    entry = (WORDPTR *) system_unit_dir;
-    while(entry[0]) {
-        baseid = entry[0];
+    while(UnitIndexTable[slot]) {
+        idx = UnitIndexTable[slot] - 1;
+        baseid = system_unit_dir[2 * idx];
+        slot = (slot + 1) & (UNITINDEXSIZE - 1);
 
-        result = rplUnitCompare(ident, baseid);
-        if(result) {
-            // WE FOUND A MATCH!
-            if(result < 0)
-                result = 0;
-            if(siindex)
-                *siindex = result;
-            return entry;
+        // THE SAME NAME MAY BE LISTED TWICE, THE FIRST ONE WINS
+        if((found >= 0) && (idx > found))
+            continue;
+        if(siprefix && (LIBNUM(*baseid) != DOIDENTSIPREFIX))
+            continue;
+        st2 = (BYTEPTR) (baseid + 1);
+        if(rplUnitNameEnd(baseid) - st2 != nameend - name)
+            continue;
+        st1 = name;
+        while((st1 != nameend) && (*st1 == *st2)) {
+            ++st1;
+            ++st2;
         }
+        if(st1 == nameend)
+            found = idx;
+    }
+    return found;
+}
+
+// FIND A UNIT IN THE USER'S UNIT DIRECTORY
+// THE DIRECTORY HASH INDEX IS USED TO FIND BOTH THE FULL NAME
+// AND THE NAME WITHOUT ITS SI PREFIX, THE FIRST ONE IN THE DIRECTORY WINS
+static WORDPTR *rplUnitFindUser(WORDPTR ident, BYTEPTR stripped, BINT siidx,
+        BINT * siindex)
+{
+    static const BYTE const unitdir_name[] = "UNITS";
 
-        entry += 2;
+    WORDPTR unitdir_obj =
+            rplGetSettingsbyName((BYTEPTR) unitdir_name,
+            (BYTEPTR) unitdir_name + 5);
+    WORDPTR *unitdir, *entry, *prefentry = 0;
+
+    if(!unitdir_obj)
+        return 0;
+    unitdir = rplFindDirbyHandle(unitdir_obj);
+    if(!unitdir)
+        return 0;
+
+    entry = rplFindGlobalInDir(ident, unitdir, 0);
+    if(siidx) {
+        prefentry =
+                rplFindGlobalbyNameInDir(stripped, rplUnitNameEnd(ident),
+                unitdir, 0);
+        if(prefentry && (LIBNUM(*prefentry[0]) != DOIDENTSIPREFIX))
+            prefentry = 0;
     }
 
-    // UNIT IS NOT DEFINED
-    return 0;
+    if(prefentry && (!entry || (prefentry < entry))) {
+        if(siindex)
+            *siindex = siidx;
+        return prefentry;
+    }
+    if(entry && siindex)
+        *siindex = 0;
+    return entry;
+}
 
+// RETURN THE START OF THE NAME OF THE UNIT AFTER SKIPPING ITS SI PREFIX
+static BYTEPTR rplUnitStripPrefix(WORDPTR ident, BINT siidx)
+{
+    BYTEPTR start = (BYTEPTR) (ident + 1);
+
+    if(!siidx)
+        return start;
+    return (BYTEPTR) utf8nskip((char *)start, (char *)rplUnitNameEnd(ident),
+            (siidx == 10) ? 2 : 1);
 }
 
 // GET THE DEFINITION OF A UNIT FROM ITS IDENTIFIER
@@ -2096,38 +2159,32 @@ WORDPTR *rplUnitFind(WORDPTR ident, BINT * siindex)
 // IF THE siindex POINTER IS NOT NULL, IT STORES THE
 // INDEX TO THE SI PREFIX THAT WAS FOUND IN THE GIVEN NAME
 
-WORDPTR *rplUnitFindCustom(WORDPTR ident, BINT * siindex)
+WORDPTR *rplUnitFind(WORDPTR ident, BINT * siindex)
 {
-    static const BYTE const unitdir_name[] = "UNITS";
-
-    WORDPTR unitdir_obj =
-            rplGetSettingsbyName((BYTEPTR) unitdir_name,
-            (BYTEPTR) unitdir_name + 5);
-    WORDPTR baseid;
-    BINT result;
+    BINT siidx = rplUnitGetSIPrefix(ident);
+    BYTEPTR stripped = rplUnitStripPrefix(ident, siidx);
+    BYTEPTR nameend = rplUnitNameEnd(ident);
     WORDPTR *entry;
+    BINT idx, prefidx;
 
-    if(unitdir_obj) {
-        // FOUND UNITS DIRECTORY IN SETTINGS, SCAN IT TO FIND OUT IDENT
-        entry = rplFindFirstByHandle(unitdir_obj);
-        while(entry) {
-            baseid = entry[0];
-
-            result = rplUnitCompare(ident, baseid);
-            if(result) {
-                // WE FOUND A MATCH!
-                if(result < 0)
-                    result = 0;
-                if(siindex)
-                    *siindex = result;
-                return entry;
-            }
+    entry = rplUnitFindUser(ident, stripped, siidx, siindex);
+    if(entry)
+        return entry;
 
-            entry = rplFindNext(entry);
-        }
+    // NOT FOUND IN THE USERS DIR, TRY THE SYSTEM LIST
 
-        // NOT FOUND IN THE USERS DIR, TRY THE SYSTEM LIST
+    idx = rplUnitFindSystem((BYTEPTR) (ident + 1), nameend, 0);
+    prefidx = siidx ? rplUnitFindSystem(stripped, nameend, 1) : -1;
 
+    if((prefidx >= 0) && ((idx < 0) || (prefidx < idx))) {
+        if(siindex)
+            *siindex = siidx;
+        return (WORDPTR *) & system_unit_dir[2 * prefidx];
+    }
+    if(idx >= 0) {
+        if(siindex)
+            *siindex = 0;
+        return (WORDPTR *) & system_unit_dir[2 * idx];
     }
 
     // UNIT IS NOT DEFINED
@@ -2135,6 +2192,17 @@ WORDPTR *rplUnitFindCustom(WORDPTR ident, BINT * siindex)
 
 }
 
+// GET THE DEFINITION OF A UNIT FROM ITS IDENTIFIER
+// SAME AS rplUnitFind() BUT ONLY SEARCHES THE USER'S UNIT DIRECTORY
+
+WORDPTR *rplUnitFindCustom(WORDPTR ident, BINT * siindex)
+{
+    BINT siidx = rplUnitGetSIPrefix(ident);
+
+    return rplUnitFindUser(ident, rplUnitStripPrefix(ident, siidx), siidx,
+            siindex);
+}
+
 // TAKE ONE UNIT IDENTIFIER GIVEN AT LEVEL, REMOVE IT FROM THE STACK WITH ITS EXPONENTS
 // AND APPEND THE UNIT DEFINITION TO THE STACK, WITH VALUE AND COEFFICIENTS
 // MODIFIED BY THE ORIGINAL EXPONENT
@@ -2215,7 +2283,7 @@ BINT rplUnitExpand(BINT level)
 
 // RECURSIVELY EXPAND ALL UNITS USING THEIR DEFINITIONS UNTIL A BASE IS REACHED
 // RETURN THE NEW TOTAL NUMBER OF ELEMENTS
-BINT rplUnitToBase(BINT nlevels)
+static BINT rplUnitToBaseNoCache(BINT nlevels)
 {
     BINT lvl = nlevels, morelevels;
 
@@ -2235,6 +2303,75 @@ BINT rplUnitToBase(BINT nlevels)
 
 }
 
+// FORGET ALL UNIT EXPANSIONS KEPT IN THE CACHE
+// MUST BE CALLED WHENEVER A USER UNIT IS DEFINED OR PURGED
+void rplUnitClearCache()
+{
+    rplClearSymbCacheKind(SYMBCACHE_UNITBASE);
+}
+
+// RECURSIVELY EXPAND ALL UNITS USING THEIR DEFINITIONS UNTIL A BASE IS REACHED
+// RETURN THE NEW TOTAL NUMBER OF ELEMENTS
+// THE EXPANSION DOESN'T DEPEND ON THE VALUE OF THE UNIT, SO THE EXPANDED
+// UNIT IS KEPT IN THE SYMBOLIC CACHE, USING THE UNIT WITHOUT ITS VALUE AS THE KEY
+BINT rplUnitToBase(BINT nlevels)
+{
+    WORDPTR *stktop = DSTop;
+    WORDPTR key, base;
+    WORD hash;
+    BINT n;
+
+    // ONLY A VALUE FOLLOWED BY AT LEAST ONE IDENTIFIER IS WORTH CACHING
+    if((nlevels < 4) || ISIDENT(*rplPeekData(nlevels)))
+        return rplUnitToBaseNoCache(nlevels);
+
+    key = rplUnitAssemble(nlevels - 1);
+    if(!key)
+        return nlevels;
+
+    base = rplSymbCacheFind(key, SYMBCACHE_UNITBASE, &hash);
+    if(!base) {
+        // EXPAND A COPY OF THE UNIT, KEEPING THE KEY IN THE STACK
+        rplPushData(key);
+        rplPushData((WORDPTR) one_bint);
+        n = rplUnitExplode(rplPeekData(2));
+        if(Exceptions) {
+            DSTop = stktop;
+            return nlevels;
+        }
+        n = rplUnitToBaseNoCache(n + 1);
+        if(Exceptions) {
+            DSTop = stktop;
+            return nlevels;
+        }
+        base = rplUnitAssemble(n - 1);
+        if(!base) {
+            DSTop = stktop;
+            return nlevels;
+        }
+        rplSymbCacheStore(rplPeekData(n + 1), SYMBCACHE_UNITBASE, hash, base);
+        DSTop = stktop;
+    }
+
+    // REPLACE THE UNIT WITH ITS EXPANSION, KEEP THE VALUE
+    rplDropData(nlevels - 1);
+    if(ISUNIT(*base))
+        n = rplUnitExplode(base);
+    else {
+        // EVERYTHING EXPANDED TO A SINGLE VALUE, PUSH IT AS-IS
+        rplPushData(base);
+        n = 1;
+    }
+    if(Exceptions) {
+        DSTop = stktop;
+        return nlevels;
+    }
+
+    // HERE ALL UNITS WERE EXPANDED TO THEIR BASES
+    return n + 1;
+
+}
+
 // RETURN TRUE/FALSE IF THE UNIT IN THE FIRST nlevels ARE CONSISTENT
 // WITH THE UNIT IN reflevel TO (nlevels+1)
 // BOTH UNITS MUST BE EXPLODED AND REDUCED TO BASE BEFOREHAND
@@ -0,0 +1,20 @@
+TEMPLATE = app
+CONFIG += console
+CONFIG -= app_bundle
+CONFIG -= qt
+
+# BUILD WITH qmake "QMAKE_CFLAGS+=-mavx2" OR "DEFINES+=NO_HOST64_KERNELS"
+# TO MEASURE THE OTHER DECIMAL KERNELS
+
+DEFINES += TARGET_PC NO_RPL_OBJECTS NDEBUG
+
+INCLUDEPATH += ../../firmware/include ../../newrpl
+
+SOURCES += \
+    main.c \
+    ../../newrpl/decimal.c \
+    ../../newrpl/sysvars.c \
+    ../../newrpl/utf8lib.c \
+    ../../newrpl/utf8data.c
+
+QMAKE_CFLAGS += -O2
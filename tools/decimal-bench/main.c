@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2014-2015, Claudio Lapilli and the newRPL Team
+ * All rights reserved.
+ * This file is released under the 3-clause BSD license.
+ * See the file LICENSE.txt that shipped with this distribution.
+ */
+
+// MEASURE THE CROSSOVER BETWEEN LONG DIVISION AND NEWTON-RAPHSON DIVISION
+// IN THE DECIMAL LIBRARY, TO TUNE NEWTON_DIV_MINWORDS FOR THIS TARGET
+
+#include <newrpl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_MINTIME   (CLOCKS_PER_SEC/20)     // RUN EACH TEST AT LEAST THIS LONG
+#define BENCH_REPEAT    5       // KEEP THE BEST OF THIS MANY RUNS
+
+const BINT bench_words[] = { 4, 8, 12, 16, 20, 24, 32, 40, 48, 64, 96, 128, 192,
+    (REAL_PRECISION_MAX + 7) / 8
+};
+
+#define BENCH_SIZES (sizeof(bench_words)/sizeof(bench_words[0]))
+
+static void random_real(REAL * r, BINT words)
+{
+    BINT k;
+    for(k = 0; k < words; ++k)
+        r->data[k] = rand() % 100000000;
+    if(!r->data[words - 1])
+        r->data[words - 1] = 1;
+    r->len = words;
+    r->exp = 0;
+    r->flags = 0;
+}
+
+// RETURN THE TIME PER DIVISION IN MICROSECONDS
+// ALTERNATE 2 DIVISORS SO THE NEWTON METHOD CAN'T REUSE ITS RECIPROCAL
+
+static double time_division(BINT words, int newton)
+{
+    clock_t start, elapsed;
+    double best = 0.0;
+    BINT k, count, rep;
+
+    for(rep = 0; rep < BENCH_REPEAT; ++rep) {
+        count = 0;
+        start = clock();
+        do {
+            for(k = 0; k < 16; ++k) {
+                if(newton)
+                    div_real_nr(&RReg[3], &RReg[0], &RReg[1 + (k & 1)],
+                            words << 3);
+                else
+                    div_real(&RReg[3], &RReg[0], &RReg[1 + (k & 1)],
+                            words << 3);
+            }
+            count += 16;
+            elapsed = clock() - start;
+        }
+        while(elapsed < BENCH_MINTIME);
+
+        if(!rep || (1e6 * elapsed / CLOCKS_PER_SEC / count < best))
+            best = 1e6 * elapsed / CLOCKS_PER_SEC / count;
+    }
+    return best;
+}
+
+int main()
+{
+    BINT k, crossover = 0;
+    double tlong, tnewton;
+
+    Context.alloc_bmp = EMPTY_STORAGEBMP;
+    initContext(REAL_PRECISION_MAX);
+    for(k = 0; k < REAL_REGISTERS; ++k)
+        RReg[k].data = allocRegister();
+
+    srand(1);
+
+    printf("WORDS    LONG(us)  NEWTON(us)\n");
+    for(k = 0; k < (BINT) BENCH_SIZES; ++k) {
+        random_real(&RReg[0], bench_words[k]);
+        random_real(&RReg[1], bench_words[k]);
+        random_real(&RReg[2], bench_words[k]);
+        Context.precdigits = bench_words[k] << 3;
+
+        tlong = time_division(bench_words[k], 0);
+        tnewton = time_division(bench_words[k], 1);
+        printf("%5d %11.2f %11.2f\n", bench_words[k], tlong, tnewton);
+
+        // CROSSOVER IS THE FIRST SIZE FROM WHICH NEWTON IS ALWAYS FASTER
+        if(tnewton >= tlong)
+            crossover = 0;
+        else if(!crossover)
+            crossover = bench_words[k];
+    }
+
+    printf("\nCOMPILED NEWTON_DIV_MINWORDS=%d\n", NEWTON_DIV_MINWORDS);
+    if(crossover)
+        printf("MEASURED NEWTON_DIV_MINWORDS=%d\n", crossover);
+    else
+        printf("NEWTON DIVISION IS NOT FASTER ON THIS TARGET\n");
+
+    return 0;
+}